@@ -0,0 +1,68 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Benchmarks
+ * @file: bench/bench_messageBufferPool.cpp
+ *
+ * Compare cost of allocating a max-size buffer per message with acquiring a buffer from a pool.
+ *******************************************************************************/
+#include "styxe/9p2000.hpp"
+#include "styxe/messageBufferPool.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+constexpr size_type kMaxMessageSize = 64 * 1024;
+
+
+void allocateBufferPerMessage(benchmark::State& state) {
+	MemoryManager memManager{kMaxMessageSize};
+	for (auto _ : state) {
+		auto buffer = memManager.allocate(kMaxMessageSize).unwrap();
+		ByteWriter dest{buffer};
+		ResponseWriter writer{dest, 1};
+		writer << Response::Write{4096};
+
+		benchmark::DoNotOptimize(buffer.view().dataAddress());
+	}
+}
+
+
+void acquireBufferFromPool(benchmark::State& state) {
+	MemoryManager memManager{kMaxMessageSize};
+	MessageBufferPool pool{memManager, kMaxMessageSize};
+	for (auto _ : state) {
+		Response::Write const response{4096};
+		auto buffer = pool.acquireFor(response).unwrap();
+		auto dest = buffer.writer();
+		ResponseWriter writer{dest, 1};
+		writer << response;
+
+		benchmark::DoNotOptimize(buffer.view().dataAddress());
+	}
+}
+
+}  // namespace
+
+
+BENCHMARK(allocateBufferPerMessage);
+BENCHMARK(acquireBufferFromPool);
@@ -0,0 +1,160 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Benchmarks
+ * @file: bench/bench_messageParser.cpp
+ *
+ * Compare runtime table based RequestParser with compile-time dialect parser.
+ *******************************************************************************/
+#include "styxe/messageWriter.hpp"
+#include "styxe/messageParser.hpp"
+#include "styxe/dialectParser.hpp"
+
+#include <benchmark/benchmark.h>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+/// A buffer holding a single encoded request.
+struct RequestFrame {
+	byte		buffer[512];
+	ByteWriter	writer{wrapMemory(buffer)};
+};
+
+
+void encode(RequestFrame& frame, Request::Read const&) {
+	RequestWriter writer{frame.writer, 1};
+	writer << Request::Read{32, 4096, 8192};
+}
+
+void encode(RequestFrame& frame, Request::Clunk const&) {
+	RequestWriter writer{frame.writer, 1};
+	writer << Request::Clunk{32};
+}
+
+void encode(RequestFrame& frame, Request::Walk const&) {
+	RequestWriter writer{frame.writer, 1};
+	writer << Request::Partial::Walk{32, 33}
+		   << StringView{"usr"}
+		   << StringView{"local"}
+		   << StringView{"include"};
+}
+
+void encode(RequestFrame& frame, _9P2000L::Request::GetAttr const&) {
+	RequestWriter writer{frame.writer, 1};
+	writer << _9P2000L::Request::GetAttr{32, 0x3fff};
+}
+
+
+template<typename Parser>
+void parseRequests(benchmark::State& state, Parser const& parser, MemoryView frame) {
+	for (auto _ : state) {
+		ByteReader reader{frame};
+		auto maybeRequest = parseMessageHeader(reader)
+				.then([&](MessageHeader header) {
+					return parser.parseRequest(header, reader);
+				});
+
+		benchmark::DoNotOptimize(maybeRequest);
+	}
+}
+
+
+template<typename Message>
+void tableParser(benchmark::State& state) {
+	RequestFrame frame;
+	encode(frame, Message{});
+
+	auto parser = createRequestParser(_9P2000L::kProtocolVersion, kMaxMessageSize);
+	parseRequests(state, *parser, frame.writer.viewWritten());
+}
+
+
+template<typename Message>
+void tableParserInto(benchmark::State& state) {
+	RequestFrame frame;
+	encode(frame, Message{});
+
+	auto parser = createRequestParser(_9P2000L::kProtocolVersion, kMaxMessageSize);
+	RequestMessage request;
+	for (auto _ : state) {
+		ByteReader reader{frame.writer.viewWritten()};
+		auto result = parseMessageHeader(reader)
+				.then([&](MessageHeader header) {
+					return parser->parseRequest(header, reader, request);
+				});
+
+		benchmark::DoNotOptimize(result);
+		benchmark::DoNotOptimize(request);
+	}
+}
+
+
+template<typename Message>
+void dialectParser(benchmark::State& state) {
+	RequestFrame frame;
+	encode(frame, Message{});
+
+	BasicRequestParser<_9P2000L::Dialect> parser{kMaxMessageSize};
+	parseRequests(state, parser, frame.writer.viewWritten());
+}
+
+
+template<typename Message>
+void dialectParserWithHandler(benchmark::State& state) {
+	RequestFrame frame;
+	encode(frame, Message{});
+
+	BasicRequestParser<_9P2000L::Dialect> parser{kMaxMessageSize};
+	for (auto _ : state) {
+		ByteReader reader{frame.writer.viewWritten()};
+		auto result = parseMessageHeader(reader)
+				.then([&](MessageHeader header) {
+					return parser.parseRequest(header, reader, [](auto const& request) {
+						benchmark::DoNotOptimize(request);
+					});
+				});
+
+		benchmark::DoNotOptimize(result);
+	}
+}
+
+}  // namespace
+
+
+BENCHMARK_TEMPLATE(tableParser, Request::Read);
+BENCHMARK_TEMPLATE(tableParserInto, Request::Read);
+BENCHMARK_TEMPLATE(dialectParser, Request::Read);
+BENCHMARK_TEMPLATE(dialectParserWithHandler, Request::Read);
+
+BENCHMARK_TEMPLATE(tableParser, Request::Clunk);
+BENCHMARK_TEMPLATE(tableParserInto, Request::Clunk);
+BENCHMARK_TEMPLATE(dialectParser, Request::Clunk);
+BENCHMARK_TEMPLATE(dialectParserWithHandler, Request::Clunk);
+
+BENCHMARK_TEMPLATE(tableParser, Request::Walk);
+BENCHMARK_TEMPLATE(tableParserInto, Request::Walk);
+BENCHMARK_TEMPLATE(dialectParser, Request::Walk);
+BENCHMARK_TEMPLATE(dialectParserWithHandler, Request::Walk);
+
+BENCHMARK_TEMPLATE(tableParser, _9P2000L::Request::GetAttr);
+BENCHMARK_TEMPLATE(tableParserInto, _9P2000L::Request::GetAttr);
+BENCHMARK_TEMPLATE(dialectParser, _9P2000L::Request::GetAttr);
+BENCHMARK_TEMPLATE(dialectParserWithHandler, _9P2000L::Request::GetAttr);
@@ -0,0 +1,214 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Benchmarks
+ * @file: bench/bench_messageWriter.cpp
+ *
+ * Compare cost of encoding a message with header and counters updated after each field
+ * with single pass encoding, where the header is written once.
+ *******************************************************************************/
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000L.hpp"
+#include "styxe/ioVecWriter.hpp"
+#include "styxe/fixedFrame.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+char const* const kPathSegments[] = {
+	"usr", "local", "share", "lib", "include", "styxe", "tests", "data",
+	"dir0", "dir1", "dir2", "dir3", "dir4", "dir5", "dir6", "file"
+};
+
+/// A buffer to encode a message into.
+struct MessageFrame {
+	byte		buffer[512];
+	ByteWriter	writer{wrapMemory(buffer)};
+};
+
+
+void encodeRead(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		RequestWriter writer{frame.writer, 1};
+		writer << Request::Read{32, 4096, 8192};
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+void encodeGetAttr(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		ResponseWriter writer{frame.writer, 1};
+		writer << _9P2000L::Response::GetAttr{};
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Walk path segments are appended one by one, header and segments count are updated after each segment.
+void encodePartialWalk(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		RequestWriter writer{frame.writer, 1};
+		auto pathWriter = writer << Request::Partial::Walk{32, 33};
+		for (auto segment : kPathSegments) {
+			pathWriter.segment(StringView{segment});
+		}
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Walk path segments are appended one by one, header and segments count are only written by finish().
+void encodePartialWalkDeferred(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		RequestWriter writer{frame.writer, 1};
+		writer.deferSizeUpdates();
+
+		auto pathWriter = writer << Request::Partial::Walk{32, 33};
+		for (auto segment : kPathSegments) {
+			pathWriter.segment(StringView{segment});
+		}
+		pathWriter.finish();
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Complete walk message, with path size known upfront.
+void encodeWalk(benchmark::State& state) {
+	MessageFrame pathFrame;
+	RequestWriter pathWriter{pathFrame.writer, 1};
+	auto partialWriter = pathWriter << Request::Partial::Walk{32, 33};
+	for (auto segment : kPathSegments) {
+		partialWriter.segment(StringView{segment});
+	}
+
+	auto const encodedPath = pathFrame.writer.viewWritten();
+	auto const pathOffset = headerSize() + 2 * sizeof(Fid) + sizeof(WalkPath::size_type);
+	Request::Walk walk{};
+	walk.fid = 32;
+	walk.newfid = 33;
+	walk.path = WalkPath{16, encodedPath.slice(pathOffset, encodedPath.size())};
+
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		RequestWriter writer{frame.writer, 1};
+		writer << walk;
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Read response with the payload copied into the message buffer.
+void encodeReadResponse(benchmark::State& state) {
+	std::vector<byte> payload(state.range(0), 0xAB);
+	std::vector<byte> buffer(headerSize() + sizeof(size_type) + payload.size());
+	ByteWriter dest{wrapMemory(buffer.data(), buffer.size())};
+	for (auto _ : state) {
+		dest.rewind();
+		ResponseWriter writer{dest, 1};
+		writer << Response::Read{wrapMemory(payload.data(), payload.size())};
+
+		benchmark::DoNotOptimize(buffer.data());
+	}
+}
+
+
+/// Read response with the payload referenced by an io vector.
+void encodeReadResponseIoVec(benchmark::State& state) {
+	std::vector<byte> payload(state.range(0), 0xAB);
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		ResponseIoVecWriter writer{frame.writer, 1};
+		writer << Response::Read{wrapMemory(payload.data(), payload.size())};
+
+		benchmark::DoNotOptimize(writer.ioVecs());
+	}
+}
+
+
+/// Header only response written by a ResponseWriter.
+void encodeClunkResponse(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		ResponseWriter writer{frame.writer, 1};
+		writer << Response::Clunk{};
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Header only response stamped from a pre-encoded frame.
+void encodeClunkResponseFrame(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		FixedFrame<Response::Clunk>::write(frame.writer, 1);
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+
+/// Write response with a count stamped into a pre-encoded frame.
+void encodeWriteResponseFrame(benchmark::State& state) {
+	MessageFrame frame;
+	for (auto _ : state) {
+		frame.writer.rewind();
+		FixedFrame<Response::Write>::write(frame.writer, 1, Response::Write{4096});
+
+		benchmark::DoNotOptimize(frame.buffer);
+	}
+}
+
+}  // namespace
+
+
+BENCHMARK(encodeRead);
+BENCHMARK(encodeGetAttr);
+BENCHMARK(encodePartialWalk);
+BENCHMARK(encodePartialWalkDeferred);
+BENCHMARK(encodeWalk);
+BENCHMARK(encodeReadResponse)->Arg(4096)->Arg(64*1024);
+BENCHMARK(encodeReadResponseIoVec)->Arg(4096)->Arg(64*1024);
+BENCHMARK(encodeClunkResponse);
+BENCHMARK(encodeClunkResponseFrame);
+BENCHMARK(encodeWriteResponseFrame);
@@ -21,7 +21,7 @@ class LibstyxeConan(ConanFile):
     }
     default_options = {"shared": False, "fPIC": True}
     generators = "cmake"
-    build_requires = "gtest/1.10.0"
+    build_requires = "gtest/1.10.0", "benchmark/1.5.0"
     requires = "libsolace/0.4.1@abbyssoul/stable"
 
     scm = {
@@ -119,6 +119,10 @@ struct MessageDump {
 		return operator() (pw.writer());
 	}
 
+	MessageDump& operator() (PartialQidWriter&& qw) {
+		return operator() (qw.writer());
+	}
+
 
 	void dumpMessage(StringView messageType, MemoryView buffer) {
 		std::stringstream sb;
@@ -245,10 +249,10 @@ void dumpAllResponses(MemoryResource& memoryResource, std::string corpusDir, Str
 	dump(responseWriter << Response::Auth{randomQid(QidType::AUTH)});
 	dump(responseWriter << Response::Flush{});
 	dump(responseWriter << Response::Attach{randomQid(QidType::MOUNT)});
-	dump(responseWriter << Response::Walk{3, {
-											  randomQid(QidType::FILE),
-											  randomQid(QidType::FILE),
-											  randomQid(QidType::FILE)}});
+	dump(responseWriter << Response::Partial::Walk{}
+						<< randomQid(QidType::FILE)
+						<< randomQid(QidType::FILE)
+						<< randomQid(QidType::FILE));
 
 	dump(responseWriter << Response::Open{randomQid(QidType::FILE), 4096});
 	dump(responseWriter << Response::Create{randomQid(QidType::FILE), 4096});
@@ -152,323 +152,46 @@ printHeader(std::ostream& ostr, ParserBase const& parser, MessageHeader const& h
 
 
 
-struct VisitRequest {
-
-    void operator()(Request::Version const& req) {
-		std::cout << ':'
-				  << field("msize") << req.msize
-				  << field("version") << req.version;
-    }
-
-    void operator()(Request::Auth const& req) {
-		std::cout << ':'
-				  << field("afid") << req.afid
-				  << field("uname") << req.uname
-				  << field("aname") << req.aname;
-    }
-
-    void operator()(Request::Attach const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("afid") << req.afid
-				  << field("uname") << req.uname
-				  << field("aname") << req.aname;
-    }
-
-    void operator()(Request::Clunk const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-    }
-
-    void operator()(Request::Flush const& req) {
-		std::cout << ':'
-				  << field("oldtag") << req.oldtag;
-    }
-
-    void operator()(Request::Open const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("mode") << req.mode;
-    }
-
-    void operator()(Request::Create const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("name") << req.name
-				  << field("perm") << req.perm
-				  << field("mode") << req.mode;
-    }
-
-
-    void operator()(Request::Read const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("offset") << req.offset
-				  << field("count") << req.count;
-    }
-
-    void operator()(Request::Write const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("offset") << req.offset
-				  << field("data") << req.data;
-    }
-
-    void operator()(Request::Remove const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-    }
-
-	void operator()(Request::Stat const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-    }
-
-    void operator()(Request::WStat const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("stat") << req.stat;
-    }
-
-    void operator()(Request::Walk const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("newfid") << req.newfid
-				  << field("path") << req.path;
-    }
-
-
-	void operator()(_9P2000U::Request::Auth const& req) {
-		operator() (static_cast<Request::Auth const&>(req));
-		std::cout
-				<< field("n_uname") << req.n_uname;
-
-	}
-	void operator()(_9P2000U::Request::Attach const& req) {
-		operator() (static_cast<Request::Attach const&>(req));
-		std::cout
-				<< field("n_uname") << req.n_uname;
-	}
-
-	void operator()(_9P2000U::Request::Create const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("name") << req.name
-				  << field("perm") << req.perm
-				  << field("mode") << req.mode
-				  << field("extension") << req.extension;
-	}
-
-	void operator()(_9P2000U::Request::WStat const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("stat") << req.stat;
-	}
-
-
-	void operator()(_9P2000E::Request::Session const& req) {
-		std::cout << ':' << wrapMemory(req.key);
-    }
-
-	void operator()(_9P2000E::Request::ShortRead const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("path") << req.path;
-    }
-
-	void operator()(_9P2000E::Request::ShortWrite const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("path") << req.path
-				  << field("data") << req.data;
-    }
-
-	void operator()(_9P2000L::Request::StatFS const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-	}
-
-	void operator()(_9P2000L::Request::LOpen const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("flags") << req.flags;
-	}
-
-	void operator()(_9P2000L::Request::LCreate const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("name") << req.name
-				  << field("flags") << req.flags
-				  << field("mode") << req.mode
-				  << field("gid") << req.gid;
-	}
-
-	void operator()(_9P2000L::Request::Symlink const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("name") << req.name
-				  << field("symtgt") << req.symtgt
-				  << field("gid") << req.gid;
-	}
-
-	void operator()(_9P2000L::Request::MkNode const& req) {
-		std::cout << ':'
-				  << field("dfid") << req.dfid
-				  << field("name") << req.name
-				  << field("mode") << req.mode
-				  << field("major") << req.major
-				  << field("minor") << req.minor
-				  << field("gid") << req.gid;
-	}
-
-	void operator()(_9P2000L::Request::Rename const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("dfid") << req.dfid
-				  << field("name") << req.name;
-	}
-
-	void operator()(_9P2000L::Request::ReadLink const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-	}
-
-	void operator()(_9P2000L::Request::GetAttr const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("request_mask") << req.request_mask;
-	}
+/// Printable representation of a message field value.
+template<typename T>
+T const& printable(T const& value) noexcept { return value; }
 
-	void operator()(_9P2000L::Request::SetAttr const& req) {
-		std::cout << ':'
-					 << field("fid") << req.fid
-					 << field("valid") << req.valid
-					 << field("mode") << req.mode
-					 << field("uid") << req.uid
-					 << field("gid") << req.gid
-					 << field("size") << req.size
-
-					 << field("atime_sec") << req.atime_sec
-					 << field("atime_nsec") << req.atime_nsec
-					 << field("mtime_sec") << req.mtime_sec
-					 << field("mtime_nsec") << req.mtime_nsec;
-	}
+/// Single byte fields are numbers, not characters.
+int printable(uint8 value) noexcept { return value; }
 
-	void operator()(_9P2000L::Request::XAttrWalk const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("newfid") << req.newfid
-				  << field("name") << req.name;
-	}
+Quoted<StringView> printable(StringView const& value) noexcept { return quote(value); }
 
-	void operator()(_9P2000L::Request::XAttrCreate const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("name") << req.name
-				  << field("attr_size") << req.attr_size
-				  << field("flags") << req.flags;
-	}
+template<std::size_t N>
+MemoryView printable(byte const (&value)[N]) noexcept { return wrapMemory(value); }
 
-	void operator()(_9P2000L::Request::ReadDir const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("offset") << req.offset
-				  << field("count") << req.count;
-	}
 
-	void operator()(_9P2000L::Request::FSync const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid;
-	}
-
-	void operator()(_9P2000L::Request::Lock const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("type") << req.type
-				  << field("flags") << req.flags
-				  << field("start") << req.start
-				  << field("length") << req.length
-				  << field("proc_id") << req.proc_id
-				  << field("client_id") << req.client_id;
-	}
+/// Print fields of any message that has a schema.
+struct PrintFields {
 
-	void operator()(_9P2000L::Request::GetLock const& req) {
-		std::cout << ':'
-				  << field("fid") << req.fid
-				  << field("type") << req.type
-				  << field("start") << req.start
-				  << field("length") << req.length
-				  << field("proc_id") << req.proc_id
-				  << field("client_id") << req.client_id;
-	}
+	template<typename MessageType>
+	void operator()(MessageType const& message) {
+		if (std::tuple_size<decltype(MessageSchema<MessageType>::fields)>::value == 0)
+			return;
 
-	void operator()(_9P2000L::Request::Link const& req) {
-		std::cout << ':'
-				  << field("dfid") << req.dfid
-				  << field("fid") << req.fid
-				  << field("name") << req.name;
+		std::cout << ':';
+		forEachField(message, [](char const* name, auto const& value) {
+			std::cout << field(name) << printable(value);
+		});
 	}
-
-	void operator()(_9P2000L::Request::MkDir const& req) {
-		std::cout << ':'
-				  << field("dfid") << req.dfid
-				  << field("name") << req.name
-				  << field("mode") << req.mode
-				  << field("gid") << req.gid;
-	}
-
-	void operator()(_9P2000L::Request::RenameAt const& req) {
-		std::cout << ':'
-				  << field("olddirfid") << req.olddirfid
-				  << field("oldname") << req.oldname
-				  << field("newdirfid") << req.newdirfid
-				  << field("newname") << req.newname;
-	}
-
-	void operator()(_9P2000L::Request::UnlinkAt const& req) {
-		std::cout << ':'
-				  << field("dfid") << req.dfid
-				  << field("name") << req.name
-				  << field("flags") << req.flags;
-	}
-
 };
 
 
-struct VisitResponse {
-
-    void operator()(Response::Version const& resp) {
-		std::cout << ':'
-				  << field("msize") << resp.msize
-				  << field("version") << resp.version;
-	}
-
-	void operator()(Response::Auth const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid;
-    }
-
-    void operator()(Response::Attach const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid;
-    }
+struct VisitResponse : public PrintFields {
+	using PrintFields::operator();
 
-    void operator()(Response::Error const& resp) {
+	void operator()(Response::Walk const& resp) {
 		std::cout << ':'
-				  << field("ename") << quote(resp.ename);
-    }
-
-	void operator()(Response::Flush const& /*res*/) noexcept { }
-
-    void operator()(Response::Walk const& resp) {
-		std::cout << ':'
-				  << resp.nqids
+				  << resp.qids.size()
 				  << " [";
 
-		auto const nqids = resp.nqids;
-		for (decltype (resp.nqids) i = 0; i < resp.nqids; ++i) {
-			auto const& qid = resp.qids[i];
-			std::cout << qid;
+		auto const nqids = resp.qids.size();
+		for (decltype (resp.qids.size()) i = 0; i < nqids; ++i) {
+			std::cout << resp.qids[i];
 			if (i + 1 != nqids) {
 				std::cout << ", ";
 			}
@@ -477,136 +200,6 @@ struct VisitResponse {
 		std::cout << ']';
 	}
 
-	void operator()(Response::Open const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid
-				  << field("iounit") << resp.iounit;
-	}
-
-	void operator()(Response::Create const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid
-				  << field("iounit") << resp.iounit;
-	}
-
-
-	void operator()(Response::Read const& resp) {
-		std::cout << ':'
-				  << field("data") << resp.data;
-	}
-	void operator()(Response::Write const& resp) {
-		std::cout << ':'
-				  << field("count") << resp.count;
-	}
-
-	void operator()(Response::Clunk& /*res*/) noexcept {}
-	void operator()(Response::Remove& /*res*/) noexcept {}
-
-	void operator()(Response::Stat const& resp) {
-		std::cout << ':'
-				  << field("size") << resp.dummySize
-				  << field("data") << resp.data;
-	}
-
-	void operator()(Response::WStat const& /*res*/) noexcept { }
-
-	void operator()(_9P2000U::Response::Error const& resp) {
-		std::cout << ':'
-				  << field("ename") << resp.ename
-				  << field("errcode") << resp.errcode;
-	}
-
-	void operator()(_9P2000U::Response::Stat const& resp) {
-		std::cout << ':'
-				  << field("size") << resp.dummySize
-				  << field("data") << resp.data;
-	}
-
-	void operator()(_9P2000E::Response::Session const& /*res*/) noexcept { }
-
-	void operator()(_9P2000E::Response::ShortRead const& resp) {
-		std::cout << ':'
-				  << resp.data;
-	}
-
-	void operator()(_9P2000E::Response::ShortWrite const& resp) {
-		std::cout << ':'
-				  << field("count") << resp.count;
-	}
-
-	void operator()(_9P2000L::Response::LError const& resp) {
-		std::cout << ':'
-				  << field("ecode") << resp.ecode;
-
-	}
-	void operator()(_9P2000L::Response::StatFS const& resp) {
-		std::cout << ':'
-				  << field("type") << resp.type
-				  << field("bsize") << resp.bsize
-				  << field("blocks") << resp.blocks
-				  << field("bfree") << resp.bfree
-				  << field("bavail") << resp.bavail
-				  << field("files") << resp.files
-				  << field("ffree") << resp.ffree
-				  << field("fsid") << resp.fsid
-				  << field("namelen") << resp.namelen;
-	}
-
-	// Following two methods are not required as the content of Response::Open and Response::LOpen are the same
-//	void operator()(_9P2000L::Response::LOpen const& resp);
-//	void operator()(_9P2000L::Response::LCreate const& resp);
-
-	void operator()(_9P2000L::Response::Symlink const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid;
-	}
-
-	void operator()(_9P2000L::Response::MkNode const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid;
-
-	}
-
-	void operator()(_9P2000L::Response::Rename const&) noexcept {}
-
-	void operator()(_9P2000L::Response::ReadLink const& resp) {
-		std::cout << ':'
-				  << field("target") << resp.target;
-	}
-
-	void operator()(_9P2000L::Response::GetAttr const& resp) {
-		std::cout << ':'
-				  << field("valid") << resp.valid
-				  << field("qid") << resp.qid
-				  << field("mode") << resp.mode
-				  << field("uid") << resp.uid
-				  << field("gid") << resp.gid
-				  << field("nlink") << resp.nlink
-				  << field("rdev") << resp.rdev
-				  << field("size") << resp.size
-				  << field("blksize") << resp.blksize
-				  << field("blocks") << resp.blocks
-				  << field("atime_sec") << resp.atime_sec
-				  << field("atime_nsec") << resp.atime_nsec
-				  << field("mtime_sec") << resp.mtime_sec
-				  << field("mtime_nsec") << resp.mtime_nsec
-				  << field("ctime_sec") << resp.ctime_sec
-				  << field("ctime_nsec") << resp.ctime_nsec
-				  << field("btime_sec") << resp.btime_sec
-				  << field("btime_nsec") << resp.btime_nsec
-				  << field("gen") << resp.gen
-				  << field("data_version") << resp.data_version;
-	}
-
-	void operator()(_9P2000L::Response::SetAttr const&) noexcept {}
-
-	void operator()(_9P2000L::Response::XAttrWalk const& resp) {
-		std::cout << ':'
-				  << field("size") << resp.size;
-	}
-
-	void operator()(_9P2000L::Response::XAttrCreate const&) noexcept { }
-
 	void operator()(_9P2000L::Response::ReadDir const& resp) {
 		std::cout << ':'
 				  << '[';
@@ -618,32 +211,6 @@ struct VisitResponse {
 
 		std::cout << ']';
 	}
-
-	void operator()(_9P2000L::Response::FSync const&) noexcept { }
-
-	void operator()(_9P2000L::Response::Lock const& resp) {
-		std::cout << ':'
-				  << field("status") << static_cast<uint32>(resp.status);
-	}
-
-	void operator()(_9P2000L::Response::GetLock const& resp) {
-		std::cout << ':'
-				  << field("type") << static_cast<uint32>(resp.type)
-				  << field("start") << resp.start
-				  << field("length") << resp.length
-				  << field("proc_id") << resp.proc_id
-				  << field("client_id") << quote(resp.client_id);
-	}
-
-	void operator()(_9P2000L::Response::Link const&) noexcept { }
-
-	void operator()(_9P2000L::Response::MkDir const& resp) {
-		std::cout << ':'
-				  << field("qid") << resp.qid;
-	}
-
-	void operator()(_9P2000L::Response::RenameAt const&) noexcept {}
-	void operator()(_9P2000L::Response::UnlinkAt const&) noexcept {}
 };
 
 
@@ -681,7 +248,7 @@ void readAndPrintMessage(std::istream& in, MemoryResource& buffer, RequestParser
 					tparser.parseRequest(header, reader)
 							.then([&tparser, &header](RequestMessage&& reqMsg) {
 								printHeader(std::cout, tparser, header);
-								std::visit(VisitRequest{}, reqMsg);
+								std::visit(PrintFields{}, reqMsg);
 							})
 							.orElse([](Error&& err) {
 								std::cerr << "Error parsing message: " << err.toString() << std::endl;
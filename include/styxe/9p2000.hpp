@@ -22,12 +22,15 @@
 #include "errorDomain.hpp"
 #include "9p.hpp"
 #include "messageWriter.hpp"
+#include "messageSchema.hpp"
 
 
 #include <solace/arrayView.hpp>
 #include <solace/string.hpp>   // Error.toString() is partial without it
 #include <solace/result.hpp>
 
+#include <cstddef>  // std::ptrdiff_t
+#include <iterator>  // std::forward_iterator_tag
 #include <variant>
 
 
@@ -97,6 +100,10 @@ bool operator== (OpenMode lhs, Solace::byte rhs) noexcept { return (lhs.mode ==
 inline
 bool operator== (Solace::byte lhs, OpenMode rhs) noexcept { return (lhs == rhs.mode); }
 
+/// OpenMode is encoded as a single byte.
+template<>
+struct FixedWireSize<OpenMode> : std::integral_constant<size_type, sizeof(OpenMode::mode)> {};
+
 
 
 /* bits in Stat.mode */
@@ -179,6 +186,93 @@ bool operator!= (Stat const& lhs, Stat const& rhs) noexcept {
 }
 
 
+/**
+ * A list of qids, such as returned by a walk response.
+ * The span refers to qids as encoded in a message buffer, each qid is only decoded when accessed.
+ * @note As other parsed messages fields, the span points into the message buffer and does not own the data.
+ */
+struct QidSpan {
+	using size_type = var_datum_size_type;
+
+	/// Size of an encoded qid in bytes.
+	static constexpr styxe::size_type kQidSize = sizeof(Qid::type) + sizeof(Qid::version) + sizeof(Qid::path);
+
+	/// Forward iterator over the qids of the span.
+	struct const_iterator {
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Qid;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Qid;
+
+		constexpr const_iterator(QidSpan const& span, size_type index) noexcept
+			: _span{&span}
+			, _index{index}
+		{}
+
+		Qid operator* () const { return (*_span)[_index]; }
+
+		const_iterator& operator++ () noexcept {
+			++_index;
+			return *this;
+		}
+
+		const_iterator operator++ (int) noexcept {
+			auto result = *this;
+			++_index;
+			return result;
+		}
+
+		constexpr bool operator== (const_iterator const& rhs) const noexcept {
+			return _span == rhs._span && _index == rhs._index;
+		}
+
+		constexpr bool operator!= (const_iterator const& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+	private:
+		QidSpan const*	_span;
+		size_type		_index;
+	};
+
+	constexpr QidSpan() noexcept = default;
+
+	/**
+	 * Construct a span of encoded qids.
+	 * @param nQids Number of qids in the span.
+	 * @param data Encoded qids. Must be exactly nQids * kQidSize bytes long.
+	 */
+	constexpr QidSpan(size_type nQids, Solace::MemoryView data) noexcept
+		: _size{nQids}
+		, _data{data}
+	{}
+
+	/// @return Number of qids in the span.
+	constexpr size_type size() const noexcept { return _size; }
+
+	/// @return True if the span has no qids.
+	constexpr bool empty() const noexcept { return _size == 0; }
+
+	/// @return Encoded qids.
+	constexpr Solace::MemoryView data() const noexcept { return _data; }
+
+	/**
+	 * Decode a qid at a given index.
+	 * @param index Index of the qid in the span.
+	 * @return Decoded qid.
+	 */
+	Qid operator[] (size_type index) const;
+
+	const_iterator begin() const noexcept { return {*this, 0}; }
+	const_iterator end() const noexcept { return {*this, _size}; }
+
+private:
+	size_type			_size{0};	//!< Number of qids in the span.
+	Solace::MemoryView	_data;		//!< Encoded qids.
+};
+
+
 
 /**
  * 9P message types
@@ -362,6 +456,7 @@ struct Request {
 struct Response {
 
 	struct Partial {
+		struct Walk {};
 		struct Read {};
 		struct Error {};
 	};
@@ -396,8 +491,7 @@ struct Response {
 
 	/// Walk response
 	struct Walk {
-		var_datum_size_type nqids;  //!< Number of qids returned
-		Qid qids[16];               //!< QIDs of the directories walked
+		QidSpan qids;  //!< QIDs of the directories walked
 	};
 
 	/// Open file response
@@ -451,6 +545,75 @@ struct Response {
 
 size_type protocolSize(Qid const& value) noexcept;
 size_type protocolSize(Stat const& value) noexcept;
+size_type protocolSize(Response::Walk const& message) noexcept;
+
+
+/**
+ * Position in a directory listing where the previous directory read has ended.
+ *
+ * Directory read requests address the listing by a byte offset. To honour it, DirListingWriter has to measure
+ * every entry from the start of the directory, that makes paging through a large directory quadratic.
+ * A server can keep a cursor per open fid instead: it maps the byte offset where the last read ended to
+ * the index of the next entry and to an opaque iterator state - such as `telldir` cookie - so that the next read
+ * resumes at that entry directly.
+ *
+ * The cursor is tied to a version of the directory, for example `Qid::version`, and is reset to the start of
+ * the listing if the directory has changed, or if a read is not a continuation of the previous one.
+ *
+ * \code{.cpp}
+...
+	fidState.cursor.seek(offset, dirQid.version);
+	DirListingWriter encoder{dest, count, offset, fidState.cursor};
+	for (auto entry = dir.seek(fidState.cursor.cookie()); entry != dir.end(); ++entry) {
+		if (!encoder.encode(mapEntryStats(*entry), entry.nextCookie())) {
+			break;
+		}
+	}
+...
+ * \endcode
+ */
+struct DirListingCursor {
+
+	/**
+	 * Position the cursor for a read at a given offset.
+	 * The cursor is kept if it points at the offset and the directory has not changed since.
+	 * Otherwise it is reset to the start of the listing, for the entries before the offset to be skipped.
+	 * @param offset Offset of the directory read request.
+	 * @param dirVersion Current version of the directory.
+	 * @return True if the cursor points at the offset,
+	 * false if it has been reset and entries before the offset are to be skipped.
+	 */
+	bool seek(Solace::uint64 offset, Solace::uint32 dirVersion) noexcept;
+
+	/**
+	 * Move the cursor past an entry of the listing.
+	 * @param entrySize Size of the entry in bytes.
+	 * @param nextCookie Iterator state of the next entry.
+	 */
+	void advance(Solace::uint64 entrySize, Solace::uint64 nextCookie) noexcept {
+		_offset += entrySize;
+		_index += 1;
+		_cookie = nextCookie;
+	}
+
+	/// @return Byte offset of the next entry in the listing.
+	constexpr Solace::uint64 offset() const noexcept { return _offset; }
+
+	/// @return Index of the next entry in the listing.
+	constexpr Solace::uint64 index() const noexcept { return _index; }
+
+	/// @return Iterator state of the next entry, 0 at the start of the listing.
+	constexpr Solace::uint64 cookie() const noexcept { return _cookie; }
+
+	/// @return Version of the directory the cursor belongs to.
+	constexpr Solace::uint32 version() const noexcept { return _version; }
+
+private:
+	Solace::uint64	_offset{0};		//!< Byte offset of the next entry.
+	Solace::uint64	_index{0};		//!< Index of the next entry.
+	Solace::uint64	_cookie{0};		//!< Iterator state of the next entry.
+	Solace::uint32	_version{0};	//!< Version of the directory.
+};
 
 
 /**
@@ -495,12 +658,36 @@ struct DirListingWriter {
 	 */
 	DirListingWriter(ResponseWriter& writer, Solace::uint32 maxBytes, Solace::uint64 offset = 0) noexcept;
 
+	/**
+	 * @brief Create an instance of Dir listing writer that resumes listing at the cursor.
+	 * Entries are expected to be fed starting from the cursor position, and the cursor is moved past each entry
+	 * either skipped or encoded.
+	 * @param writer Output stream where resuling data is written.
+	 * @param maxBytes Maximum number of bytes that can be written into dest.
+	 * @param offset Number of bytes to skip.
+	 * @param cursor Directory listing cursor, positioned at the offset with DirListingCursor::seek.
+	 */
+	DirListingWriter(ResponseWriter& writer, Solace::uint32 maxBytes, Solace::uint64 offset,
+					 DirListingCursor& cursor) noexcept;
+
 	/**
 	 * @brief Encode directory entry into response message
+	 * Iterator state stored in the cursor, if any, is left unchanged.
 	 * @param stat Directory entry stat.
 	 * @return True if more entries can be encoded.
 	 */
-	bool encode(Stat const& stat);
+	bool encode(Stat const& stat) {
+		return encode(stat, _cursor ? _cursor->cookie() : 0);
+	}
+
+	/**
+	 * @brief Encode directory entry into response message
+	 * @param stat Directory entry stat.
+	 * @param nextCookie Iterator state of the entry following this one, stored in the cursor if the entry fits.
+	 * @return True if the entry has been consumed and more entries can be encoded,
+	 * false if the entry does not fit into the response.
+	 */
+	bool encode(Stat const& stat, Solace::uint64 nextCookie);
 
 	/// Update response writer with the current payload size.
 	void updateDataSize();
@@ -528,6 +715,148 @@ private:
 	Solace::uint32			_bytesEncoded{0};
 	/// Writer to write data to.
 	ResponseWriter&			_writer;
+	/// Cursor to move past consumed entries, if any.
+	DirListingCursor*		_cursor{nullptr};
+};
+
+
+/**
+ * Reader of directory entries returned by a 9P2000 `read` of a directory: a sequence of concatenated Stat records.
+ * @see DirListingWriter
+ *
+ * Each record starts with its size, so the reader steps over records using the size prefix alone.
+ * A record is only decoded when an iterator is dereferenced, thus counting or skipping entries is cheap.
+ * Dereferencing an iterator yields a decoded record or an error if the record is ill-formed. A trailing record
+ * that is not complete, for example if a listing has been truncated, is the last one and yields an error.
+ *
+ * @tparam StatType Type of the stat records: Stat for 9P2000 or _9P2000U::StatEx for 9P2000.u.
+ */
+template<typename StatType>
+struct StatReader {
+	using size_type = Solace::MemoryView::size_type;
+
+	/// Forward iterator over the stat records.
+	struct const_iterator {
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Result<StatType>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = Result<StatType>;
+
+		const_iterator(Solace::MemoryView buffer, size_type offset) noexcept
+			: _buffer{buffer}
+			, _offset{offset}
+			, _recordSize{availableSizeAt(buffer, offset)}
+		{}
+
+		/**
+		 * Decode the record the iterator points to.
+		 * @return Decoded stat or an error if the record is incomplete or ill-formed.
+		 */
+		Result<StatType> operator* () const {
+			if (_recordSize != recordSizeAt(_buffer, _offset)) {
+				return getCannedError(CannedError::NotEnoughData);
+			}
+
+			Solace::ByteReader reader{record()};
+			Decoder decoder{reader};
+
+			Result<StatType> result{Solace::types::okTag, Solace::in_place};
+			auto decoded = decoder >> *result;
+			if (!decoded) {
+				result = Result<StatType>{Solace::types::errTag, decoded.moveError()};
+			}
+
+			return result;
+		}
+
+		/// @return Raw bytes of the record the iterator points to, including size prefix.
+		Solace::MemoryView record() const noexcept { return _buffer.slice(_offset, _offset + _recordSize); }
+
+		const_iterator& operator++ () noexcept {
+			_offset += _recordSize;
+			_recordSize = availableSizeAt(_buffer, _offset);
+
+			return *this;
+		}
+
+		const_iterator operator++ (int) noexcept {
+			auto result = *this;
+			++(*this);
+			return result;
+		}
+
+		constexpr bool operator== (const_iterator const& rhs) const noexcept {
+			return _buffer.dataAddress() == rhs._buffer.dataAddress() && _offset == rhs._offset;
+		}
+
+		constexpr bool operator!= (const_iterator const& rhs) const noexcept {
+			return !(*this == rhs);
+		}
+
+	private:
+		Solace::MemoryView	_buffer;		//!< Buffer of records.
+		size_type			_offset;		//!< Offset of the current record.
+		size_type			_recordSize;	//!< Size of the current record, including size prefix.
+	};
+
+	/**
+	 * Construct a new StatReader.
+	 * @param buffer Data of a directory read response.
+	 */
+	constexpr StatReader(Solace::MemoryView buffer) noexcept
+		: _buffer{buffer}
+	{}
+
+	/// @return Buffer of records.
+	constexpr Solace::MemoryView buffer() const noexcept { return _buffer; }
+
+	const_iterator begin() const noexcept { return {_buffer, 0}; }
+	const_iterator end() const noexcept { return {_buffer, _buffer.size()}; }
+
+	/**
+	 * Count complete records in the buffer. Only size prefixes are read.
+	 * @return Number of records.
+	 */
+	size_type count() const noexcept {
+		size_type result = 0;
+		for (size_type offset = 0, recordSize = recordSizeAt(_buffer, 0);
+			 recordSize != 0;
+			 offset += recordSize, recordSize = recordSizeAt(_buffer, offset)) {
+			result += 1;
+		}
+
+		return result;
+	}
+
+private:
+
+	/**
+	 * Get size of a record at a given offset.
+	 * @return Size of the record including size prefix, or 0 if there is no complete record at the offset.
+	 */
+	static size_type recordSizeAt(Solace::MemoryView buffer, size_type offset) noexcept {
+		if (buffer.size() < offset + sizeof(var_datum_size_type)) {
+			return 0;
+		}
+
+		auto const prefix = buffer.dataAddress() + offset;
+		auto const recordSize = sizeof(var_datum_size_type) + static_cast<size_type>(prefix[0] | (prefix[1] << 8));
+		return (recordSize <= buffer.size() - offset) ? recordSize : 0;
+	}
+
+	/**
+	 * Get number of bytes of a record at a given offset that are in the buffer.
+	 * @return Size of a complete record, the rest of the buffer if the record is incomplete, or 0 at the end.
+	 */
+	static size_type availableSizeAt(Solace::MemoryView buffer, size_type offset) noexcept {
+		auto const recordSize = recordSizeAt(buffer, offset);
+		return (recordSize != 0 || offset >= buffer.size())
+				? recordSize
+				: buffer.size() - offset;
+	}
+
+	Solace::MemoryView	_buffer;  //!< Buffer of records.
 };
 
 
@@ -544,6 +873,16 @@ Encoder& operator<< (Encoder& encoder, Qid value) {
 
 }
 
+/** Encode a file open mode into the output stream.
+ * @param encoder Encoder used to encode the value.
+ * @param value Value to encode.
+ * @return Ref to the encoder for fluency.
+ */
+inline
+Encoder& operator<< (Encoder& encoder, OpenMode value) {
+	return encoder << value.mode;
+}
+
 /** Encode a file stats into the output stream.
  * @param encoder Encoder used to encode the value.
  * @param value Value to encode.
@@ -588,10 +927,9 @@ inline
 Encoder& operator<< (Encoder& encoder, WalkPath const& path) {
 	// Encode variable datum size first:
 	encoder << path.size();
-	// Datum
-	for (auto segment : path) {
-		encoder << segment;
-	}
+	// Datum: segments are stored in the wire format already, thus written with a single copy.
+	auto const segmentsSize = protocolSize(path) - sizeof(WalkPath::size_type);
+	encoder.buffer().write(path.data().slice(0, segmentsSize));
 
 	return encoder;
 }
@@ -610,6 +948,17 @@ Solace::Result<Decoder&, Error> operator>> (Decoder& decoder, Qid& dest) {
 }
 
 
+/** Decode a file open mode from the stream.
+ * @param decoder A data stream to read a value from.
+ * @param dest An address where to store decoded value.
+ * @return Ref to the decoder or Error if operation has failed.
+ */
+inline
+Solace::Result<Decoder&, Error> operator>> (Decoder& decoder, OpenMode& dest) {
+	return decoder >> dest.mode;
+}
+
+
 /** Decode a Stat struct from the stream.
  * @param decoder A data stream to read a value from.
  * @param dest An address where to store decoded value.
@@ -859,6 +1208,13 @@ PartialDataWriter operator<< (ResponseWriter& writer, Response::Partial::Read co
 
 PartialStringWriter operator<< (ResponseWriter& writer, Response::Partial::Error const& response);
 
+/**
+ * Create partial Walk response.
+ * Qids of the walked path elements are appended to the message with `<<` operator.
+ * @return Partial writer.
+ */
+PartialQidWriter operator<< (ResponseWriter& writer, Response::Partial::Walk const& response);
+
 
 Solace::Result<Solace::ByteReader&, Error>
 operator>> (Solace::ByteReader& data, Request::Version& dest);
@@ -978,6 +1334,36 @@ template <>
 constexpr Solace::byte messageCodeOf<Response::WStat>() noexcept { return asByte(MessageType::RWStat); }
 
 
+STYXE_MESSAGE_SCHEMA(Request::Version, STYXE_FIELD(msize), STYXE_FIELD(version));
+STYXE_MESSAGE_SCHEMA(Request::Auth, STYXE_FIELD(afid), STYXE_FIELD(uname), STYXE_FIELD(aname));
+STYXE_MESSAGE_SCHEMA(Request::Flush, STYXE_FIELD(oldtag));
+STYXE_MESSAGE_SCHEMA(Request::Attach, STYXE_FIELD(fid), STYXE_FIELD(afid), STYXE_FIELD(uname), STYXE_FIELD(aname));
+STYXE_MESSAGE_SCHEMA(Request::Walk, STYXE_FIELD(fid), STYXE_FIELD(newfid), STYXE_FIELD(path));
+STYXE_MESSAGE_SCHEMA(Request::Open, STYXE_FIELD(fid), STYXE_FIELD(mode));
+STYXE_MESSAGE_SCHEMA(Request::Create, STYXE_FIELD(fid), STYXE_FIELD(name), STYXE_FIELD(perm), STYXE_FIELD(mode));
+STYXE_MESSAGE_SCHEMA(Request::Read, STYXE_FIELD(fid), STYXE_FIELD(offset), STYXE_FIELD(count));
+STYXE_MESSAGE_SCHEMA(Request::Write, STYXE_FIELD(fid), STYXE_FIELD(offset), STYXE_FIELD(data));
+STYXE_MESSAGE_SCHEMA(Request::Clunk, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(Request::Remove, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(Request::Stat, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(Request::WStat, STYXE_FIELD(fid), STYXE_FIELD(stat));
+
+STYXE_MESSAGE_SCHEMA(Response::Version, STYXE_FIELD(msize), STYXE_FIELD(version));
+STYXE_MESSAGE_SCHEMA(Response::Auth, STYXE_FIELD(qid));
+STYXE_MESSAGE_SCHEMA(Response::Attach, STYXE_FIELD(qid));
+STYXE_MESSAGE_SCHEMA(Response::Error, STYXE_FIELD(ename));
+STYXE_EMPTY_MESSAGE_SCHEMA(Response::Flush);
+// Note: Response::Walk has no schema as qids are kept encoded, @see QidSpan.
+STYXE_MESSAGE_SCHEMA(Response::Open, STYXE_FIELD(qid), STYXE_FIELD(iounit));
+STYXE_MESSAGE_SCHEMA(Response::Create, STYXE_FIELD(qid), STYXE_FIELD(iounit));
+STYXE_MESSAGE_SCHEMA(Response::Read, STYXE_FIELD(data));
+STYXE_MESSAGE_SCHEMA(Response::Write, STYXE_FIELD(count));
+STYXE_EMPTY_MESSAGE_SCHEMA(Response::Clunk);
+STYXE_EMPTY_MESSAGE_SCHEMA(Response::Remove);
+STYXE_MESSAGE_SCHEMA(Response::Stat, STYXE_FIELD(dummySize), STYXE_FIELD(data));
+STYXE_EMPTY_MESSAGE_SCHEMA(Response::WStat);
+
+
 /**
  * Get a string representation of the message name given the op-code.
  * @param messageType Message op-code to convert to a string.
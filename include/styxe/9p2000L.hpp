@@ -310,6 +310,13 @@ struct Request {
 
 /// 9P2000.L responses
 struct Response {
+
+	/// Partial responses, that have data appended or written in place. @see PartialDataWriter::reserve
+	struct Partial {
+		struct ReadDir {};		//!< Partial read directory response. @see ReadDir
+		struct ReadLink {};		//!< Partial read link response. @see ReadLink
+	};
+
 	/// Error resoponse from a server
 	struct LError {
 		Solace::uint32		ecode;  //!< Error code
@@ -551,9 +558,107 @@ begin(DirEntryReader& reader) noexcept { return {reader.buffer(), 0}; }
 inline DirEntryReader::Iterator
 end(DirEntryReader& reader) noexcept { return {reader.buffer(), reader.buffer().size()}; }
 
+
+/**
+ * A helper class to build Rreaddir response content on the server side.
+ * @see _9P2000L::Response::ReadDir
+ *
+ * Directory entries are encoded into the response one by one until the next entry would exceed `count` bytes
+ * requested by the client. Entries are never split: an entry that does not fit is left for the next request,
+ * that starts at the offset returned by nextOffset().
+ * Data size and message size are written once, when the response is finished.
+ *
+ * \code{.cpp}
+...
+	ReadDirWriter dirWriter{responseWriter, request.count, request.offset};
+	auto entry = dir.seek(request.offset);
+	auto nextOffset = dirWriter.fill([&](DirEntry& dirEntry) {
+		if (entry == dir.end())
+			return false;
+
+		dirEntry = mapEntry(*entry++);
+		return true;
+	});
+...
+ * \endcode
+ */
+struct ReadDirWriter {
+
+	/**
+	 * Construct a new ReadDirWriter and write Rreaddir message header.
+	 * @param writer Output stream where resuling data is written.
+	 * @param count Maximum number of bytes of directory entries requested.
+	 * @param offset Offset in the directory of the first entry, as requested.
+	 */
+	ReadDirWriter(ResponseWriter& writer, Solace::uint32 count, Solace::uint64 offset = 0) noexcept;
+
+	/**
+	 * Encode directory entry into the response.
+	 * @param entry Directory entry to encode.
+	 * @return True if the entry has been encoded, false if it does not fit into the response.
+	 */
+	bool encode(DirEntry const& entry);
+
+	/**
+	 * Encode directory entries produced by a generator into the response and finish the response.
+	 * @param next Generator invoked as `bool next(DirEntry& entry)` to produce the next entry.
+	 * It returns false when there are no more entries. Not invoked any more once the response is full.
+	 * @return Offset to read the entries following the encoded ones.
+	 */
+	template<typename Generator>
+	Solace::uint64 fill(Generator&& next) {
+		DirEntry entry{};
+		while (next(entry) && encode(entry)) {
+		}
+
+		finish();
+		return nextOffset();
+	}
+
+	/**
+	 * Finish the message: write the final data size and message size.
+	 * @return Ref to the original message writer.
+	 */
+	ResponseWriter& finish();
+
+	/**
+	 * Get offset to read the directory from to get the entries following the encoded ones.
+	 * @return Offset of the last encoded entry, or the requested offset if no entries were encoded.
+	 */
+	constexpr Solace::uint64 nextOffset() const noexcept { return _nextOffset; }
+
+	/**
+	 * Get number of bytes of directory entries encoded.
+	 * @return Number of bytes encoded so far.
+	 */
+	constexpr Solace::uint32 bytesEncoded() const noexcept { return _bytesEncoded; }
+
+	/**
+	 * Get number of directory entries encoded.
+	 * @return Number of entries encoded so far.
+	 */
+	constexpr Solace::uint32 size() const noexcept { return _nEntries; }
+
+private:
+	/// Writer to write data to.
+	ResponseWriter&					_writer;
+	/// Position in the output stream of the data size field.
+	Solace::ByteWriter::size_type	_dataPosition;
+	/// Max number of bytes to write.
+	Solace::uint32 const			_count;
+	/// Number of bytes written.
+	Solace::uint32					_bytesEncoded{0};
+	/// Number of entries written.
+	Solace::uint32					_nEntries{0};
+	/// Offset to read following entries from.
+	Solace::uint64					_nextOffset;
+};
+
 }  // end of namespace _9P2000L
 
 
+size_type protocolSize(_9P2000L::DirEntry const& value) noexcept;
+
 inline
 Encoder& operator<< (Encoder& encoder, _9P2000L::DirEntry const& value) {
 	return encoder << value.qid
@@ -612,6 +717,18 @@ ResponseWriter& operator<< (ResponseWriter& writer, _9P2000L::Response::MkDir co
 ResponseWriter& operator<< (ResponseWriter& writer, _9P2000L::Response::RenameAt const& dest);
 ResponseWriter& operator<< (ResponseWriter& writer, _9P2000L::Response::UnlinkAt const& dest);
 
+/**
+ * Create partial Rreaddir response.
+ * @return Partial writer to append encoded directory entries or reserve space for them to.
+ */
+PartialDataWriter operator<< (ResponseWriter& writer, _9P2000L::Response::Partial::ReadDir const& dest);
+
+/**
+ * Create partial Rreadlink response.
+ * @return Partial writer to append link target or reserve space for it to.
+ */
+PartialStringWriter operator<< (ResponseWriter& writer, _9P2000L::Response::Partial::ReadLink const& dest);
+
 
 
 Solace::Result<Solace::ByteReader&, Error>
@@ -822,5 +939,79 @@ constexpr Solace::byte
 messageCodeOf<_9P2000L::Response::UnlinkAt>() noexcept { return asByte(_9P2000L::MessageType::Runlinkat); }
 
 
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::StatFS, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::LOpen, STYXE_FIELD(fid), STYXE_FIELD(flags));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::LCreate,
+					 STYXE_FIELD(fid), STYXE_FIELD(name), STYXE_FIELD(flags), STYXE_FIELD(mode), STYXE_FIELD(gid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::Symlink,
+					 STYXE_FIELD(fid), STYXE_FIELD(name), STYXE_FIELD(symtgt), STYXE_FIELD(gid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::MkNode,
+					 STYXE_FIELD(dfid), STYXE_FIELD(name), STYXE_FIELD(mode),
+					 STYXE_FIELD(major), STYXE_FIELD(minor), STYXE_FIELD(gid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::Rename, STYXE_FIELD(fid), STYXE_FIELD(dfid), STYXE_FIELD(name));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::ReadLink, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::GetAttr, STYXE_FIELD(fid), STYXE_FIELD(request_mask));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::SetAttr,
+					 STYXE_FIELD(fid), STYXE_FIELD(valid), STYXE_FIELD(mode),
+					 STYXE_FIELD(uid), STYXE_FIELD(gid), STYXE_FIELD(size),
+					 STYXE_FIELD(atime_sec), STYXE_FIELD(atime_nsec),
+					 STYXE_FIELD(mtime_sec), STYXE_FIELD(mtime_nsec));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::XAttrWalk, STYXE_FIELD(fid), STYXE_FIELD(newfid), STYXE_FIELD(name));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::XAttrCreate,
+					 STYXE_FIELD(fid), STYXE_FIELD(name), STYXE_FIELD(attr_size), STYXE_FIELD(flags));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::ReadDir, STYXE_FIELD(fid), STYXE_FIELD(offset), STYXE_FIELD(count));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::FSync, STYXE_FIELD(fid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::Lock,
+					 STYXE_FIELD(fid), STYXE_FIELD(type), STYXE_FIELD(flags),
+					 STYXE_FIELD(start), STYXE_FIELD(length),
+					 STYXE_FIELD(proc_id), STYXE_FIELD(client_id));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::GetLock,
+					 STYXE_FIELD(fid), STYXE_FIELD(type),
+					 STYXE_FIELD(start), STYXE_FIELD(length),
+					 STYXE_FIELD(proc_id), STYXE_FIELD(client_id));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::Link, STYXE_FIELD(dfid), STYXE_FIELD(fid), STYXE_FIELD(name));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::MkDir,
+					 STYXE_FIELD(dfid), STYXE_FIELD(name), STYXE_FIELD(mode), STYXE_FIELD(gid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::RenameAt,
+					 STYXE_FIELD(olddirfid), STYXE_FIELD(oldname), STYXE_FIELD(newdirfid), STYXE_FIELD(newname));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Request::UnlinkAt, STYXE_FIELD(dfid), STYXE_FIELD(name), STYXE_FIELD(flags));
+
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::LError, STYXE_FIELD(ecode));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::StatFS,
+					 STYXE_FIELD(type), STYXE_FIELD(bsize),
+					 STYXE_FIELD(blocks), STYXE_FIELD(bfree), STYXE_FIELD(bavail),
+					 STYXE_FIELD(files), STYXE_FIELD(ffree),
+					 STYXE_FIELD(fsid), STYXE_FIELD(namelen));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::LOpen, STYXE_FIELD(qid), STYXE_FIELD(iounit));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::LCreate, STYXE_FIELD(qid), STYXE_FIELD(iounit));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::Symlink, STYXE_FIELD(qid));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::MkNode, STYXE_FIELD(qid));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::Rename);
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::ReadLink, STYXE_FIELD(target));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::GetAttr,
+					 STYXE_FIELD(valid), STYXE_FIELD(qid), STYXE_FIELD(mode),
+					 STYXE_FIELD(uid), STYXE_FIELD(gid),
+					 STYXE_FIELD(nlink), STYXE_FIELD(rdev), STYXE_FIELD(size),
+					 STYXE_FIELD(blksize), STYXE_FIELD(blocks),
+					 STYXE_FIELD(atime_sec), STYXE_FIELD(atime_nsec),
+					 STYXE_FIELD(mtime_sec), STYXE_FIELD(mtime_nsec),
+					 STYXE_FIELD(ctime_sec), STYXE_FIELD(ctime_nsec),
+					 STYXE_FIELD(btime_sec), STYXE_FIELD(btime_nsec),
+					 STYXE_FIELD(gen), STYXE_FIELD(data_version));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::SetAttr);
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::XAttrWalk, STYXE_FIELD(size));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::XAttrCreate);
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::ReadDir, STYXE_FIELD(data));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::FSync);
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::Lock, STYXE_FIELD(status));
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::GetLock,
+					 STYXE_FIELD(type), STYXE_FIELD(start), STYXE_FIELD(length),
+					 STYXE_FIELD(proc_id), STYXE_FIELD(client_id));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::Link);
+STYXE_MESSAGE_SCHEMA(_9P2000L::Response::MkDir, STYXE_FIELD(qid));
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::RenameAt);
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000L::Response::UnlinkAt);
+
+
 }  // end of namespace styxe
 #endif  // STYXE_9P2000L_HPP
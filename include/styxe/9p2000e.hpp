@@ -139,6 +139,15 @@ constexpr Solace::byte messageCodeOf<_9P2000E::Response::ShortWrite>() noexcept
 { return asByte(_9P2000E::MessageType::RShortWrite); }
 
 
+STYXE_MESSAGE_SCHEMA(_9P2000E::Request::Session, STYXE_FIELD(key));
+STYXE_MESSAGE_SCHEMA(_9P2000E::Request::ShortRead, STYXE_FIELD(fid), STYXE_FIELD(path));
+STYXE_MESSAGE_SCHEMA(_9P2000E::Request::ShortWrite, STYXE_FIELD(fid), STYXE_FIELD(path), STYXE_FIELD(data));
+
+STYXE_EMPTY_MESSAGE_SCHEMA(_9P2000E::Response::Session);
+STYXE_MESSAGE_SCHEMA(_9P2000E::Response::ShortRead, STYXE_FIELD(data));
+STYXE_MESSAGE_SCHEMA(_9P2000E::Response::ShortWrite, STYXE_FIELD(count));
+
+
 Solace::Result<Solace::ByteReader&, Error>
 operator>> (Solace::ByteReader& data, _9P2000E::Request::Session& dest);
 
@@ -177,6 +186,13 @@ ResponseWriter& operator<< (ResponseWriter& writer, _9P2000E::Response::ShortRea
 ResponseWriter& operator<< (ResponseWriter& writer, _9P2000E::Response::ShortWrite const& response);
 
 
+/**
+ * Create partial ShortRead response.
+ * @return Partial writer to append data or reserve space for data to.
+ */
+PartialDataWriter operator<< (ResponseWriter& writer, _9P2000E::Response::Partial::ShortRead const& response);
+
+
 PartialPathWriter operator<< (RequestWriter& writer, _9P2000E::Request::Partial::ShortRead const& request);
 PathDataWriter operator<< (RequestWriter& writer, _9P2000E::Request::Partial::ShortWrite const& request);
 
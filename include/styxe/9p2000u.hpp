@@ -224,5 +224,17 @@ template <>
 constexpr Solace::byte messageCodeOf<_9P2000U::Response::Error>() noexcept { return asByte(MessageType::RError); }
 
 
+STYXE_MESSAGE_SCHEMA(_9P2000U::Request::Auth,
+					 STYXE_FIELD(afid), STYXE_FIELD(uname), STYXE_FIELD(aname), STYXE_FIELD(n_uname));
+STYXE_MESSAGE_SCHEMA(_9P2000U::Request::Attach,
+					 STYXE_FIELD(fid), STYXE_FIELD(afid), STYXE_FIELD(uname), STYXE_FIELD(aname), STYXE_FIELD(n_uname));
+STYXE_MESSAGE_SCHEMA(_9P2000U::Request::Create,
+					 STYXE_FIELD(fid), STYXE_FIELD(name), STYXE_FIELD(perm), STYXE_FIELD(mode), STYXE_FIELD(extension));
+STYXE_MESSAGE_SCHEMA(_9P2000U::Request::WStat, STYXE_FIELD(fid), STYXE_FIELD(stat));
+
+STYXE_MESSAGE_SCHEMA(_9P2000U::Response::Error, STYXE_FIELD(ename), STYXE_FIELD(errcode));
+STYXE_MESSAGE_SCHEMA(_9P2000U::Response::Stat, STYXE_FIELD(dummySize), STYXE_FIELD(data));
+
+
 }  // end of namespace styxe
 #endif  // STYXE_9P2000U_HPP
@@ -0,0 +1,125 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_ARENA_HPP
+#define STYXE_ARENA_HPP
+
+#include "styxe/messageParser.hpp"
+
+#include <solace/memoryView.hpp>
+#include <solace/stringView.hpp>
+
+
+namespace styxe {
+
+/**
+ * Bump-pointer arena to copy message data into.
+ *
+ * Memory is allocated from a user provided buffer by advancing a pointer, and is only released all at once by
+ * resetting the arena. Used to make owning copies of parsed messages, @see clone.
+ *
+ * @note The arena does not allocate memory, the buffer must outlive the arena and all allocations.
+ */
+struct Arena {
+	using size_type = Solace::MemoryView::size_type;
+
+	/**
+	 * Construct a new arena.
+	 * @param buffer Memory to allocate from.
+	 */
+	constexpr explicit Arena(Solace::MutableMemoryView buffer) noexcept
+		: _buffer{buffer}
+	{}
+
+	Arena(Arena const&) = delete;
+	Arena& operator= (Arena const&) = delete;
+
+	/// @return Size of the arena memory in bytes.
+	constexpr size_type capacity() const noexcept { return _buffer.size(); }
+
+	/// @return Number of bytes allocated since the last reset.
+	constexpr size_type size() const noexcept { return _used; }
+
+	/// @return Number of bytes left for allocation.
+	constexpr size_type remaining() const noexcept { return capacity() - _used; }
+
+	/**
+	 * Allocate a block of memory.
+	 * @param size Number of bytes to allocate.
+	 * @return Allocated memory or an error if the arena has not enough space left.
+	 */
+	Result<Solace::MutableMemoryView> allocate(size_type size);
+
+	/**
+	 * Copy data into the arena.
+	 * @param data Data to copy.
+	 * @return View of the copy or an error if the arena has not enough space left.
+	 */
+	Result<Solace::MemoryView> copy(Solace::MemoryView data);
+
+	/**
+	 * Copy a string into the arena.
+	 * @param str String to copy.
+	 * @return View of the copy or an error if the arena has not enough space left.
+	 */
+	Result<Solace::StringView> copy(Solace::StringView str);
+
+	/**
+	 * Release all allocations at once.
+	 * @note Views of the data copied into the arena are invalidated.
+	 */
+	void reset() noexcept { _used = 0; }
+
+private:
+	friend Result<RequestMessage> clone(RequestMessage const& message, Arena& arena);
+	friend Result<ResponseMessage> clone(ResponseMessage const& message, Arena& arena);
+
+	/**
+	 * Release allocations made after a given point.
+	 * Used to drop the data copied for a message that could not be cloned in full.
+	 * @param size Number of bytes allocated at that point, as returned by size().
+	 */
+	void rewind(size_type size) noexcept { _used = size; }
+
+	Solace::MutableMemoryView	_buffer;
+	size_type					_used{0};
+};
+
+
+/**
+ * Make an owning copy of a parsed request.
+ * Strings, paths and data payload the request refers to are copied into the arena and the copy refers to them,
+ * so that the buffer the request was parsed from can be reused.
+ * @param message A request to copy.
+ * @param arena An arena to copy data into.
+ * @return Copy of the request or an error if the arena has not enough space left.
+ * Nothing is left allocated in the arena in case of an error.
+ */
+Result<RequestMessage> clone(RequestMessage const& message, Arena& arena);
+
+/**
+ * Make an owning copy of a parsed response.
+ * Strings, qids and data payload the response refers to are copied into the arena and the copy refers to them,
+ * so that the buffer the response was parsed from can be reused.
+ * @param message A response to copy.
+ * @param arena An arena to copy data into.
+ * @return Copy of the response or an error if the arena has not enough space left.
+ * Nothing is left allocated in the arena in case of an error.
+ */
+Result<ResponseMessage> clone(ResponseMessage const& message, Arena& arena);
+
+}  // end of namespace styxe
+#endif  // STYXE_ARENA_HPP
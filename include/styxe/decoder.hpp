@@ -99,12 +99,61 @@ Solace::Result<Decoder&, Solace::Error> operator>> (Decoder& decoder, Solace::St
 Solace::Result<Decoder&, Solace::Error> operator>> (Decoder& decoder, Solace::MemoryView& dest);
 
 /** Decode a path view from the stream.
+ * Segments are checked to be within the bounds of the stream and to be valid file names in a single pass.
  * @param decoder A data stream to read a value from.
  * @param dest An address where to store decoded value.
  * @return Ref to the decoder or Error if operation has failed.
  */
 Solace::Result<Decoder&, Solace::Error> operator>> (Decoder& decoder, WalkPath& dest);
 
+
+/**
+ * A path decoded together with the offsets of its segments.
+ * Unlike WalkPath, that re-reads length prefixes of all preceding segments, any segment is accessed in O(1).
+ * Index is built by the same single pass that validates the path.
+ */
+struct WalkPathIndex {
+	using size_type = WalkPath::size_type;
+
+	/// Maximum number of path segments in a walk message as defined by the protocol.
+	static constexpr size_type kMaxSegments = 16;
+
+	/// @return Indexed path.
+	WalkPath path() const noexcept { return WalkPath{_size, _data}; }
+
+	/// @return Number of segments in the path.
+	constexpr size_type size() const noexcept { return _size; }
+
+	/// @return True if the path has no segments.
+	constexpr bool empty() const noexcept { return _size == 0; }
+
+	/**
+	 * Get path segment at a given index.
+	 * @param index Index of a segment.
+	 * @return Path segment.
+	 */
+	Solace::StringView operator[] (size_type index) const;
+
+	/// @return True if any of the segments is '..', that is the path walks up the directory tree.
+	constexpr bool hasParentSegments() const noexcept { return _hasParentSegments; }
+
+private:
+	friend Solace::Result<Decoder&, Solace::Error> operator>> (Decoder& decoder, WalkPathIndex& dest);
+
+	Solace::MemoryView	_data;								//!< Encoded path segments.
+	Solace::uint32		_offsets[kMaxSegments + 1] = {};	//!< Offsets of segments length prefixes and of the path end.
+	size_type			_size{0};							//!< Number of segments in the path.
+	bool				_hasParentSegments{false};			//!< True if any of the segments is '..'.
+};
+
+/** Decode a path from the stream and index its segments.
+ * @param decoder A data stream to read a value from.
+ * @param dest An address where to store decoded value.
+ * @return Ref to the decoder or Error if operation has failed,
+ * including when the path has more than WalkPathIndex::kMaxSegments segments.
+ */
+Solace::Result<Decoder&, Solace::Error> operator>> (Decoder& decoder, WalkPathIndex& dest);
+
 /**
  * An interop for Result<Decoder&, Solace::Error>.
  * @param decoder A data stream to read a value from.
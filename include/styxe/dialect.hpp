@@ -0,0 +1,564 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_DIALECT_HPP
+#define STYXE_DIALECT_HPP
+
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000e.hpp"
+#include "styxe/9p2000u.hpp"
+#include "styxe/9p2000L.hpp"
+
+#include <utility>  // std::forward
+#include <variant>
+
+
+namespace styxe {
+
+/**
+ * Type tag used to pass a message type to a generic callable.
+ * Message type is available as `typename decltype(tag)::type`.
+ */
+template<typename T>
+struct MessageTypeTag {
+	using type = T;  //!< Tagged message type.
+};
+
+namespace _9P2000 {
+
+/**
+ * Type representing a request message of 9P2000 dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::RequestMessage for a variant of all messages.
+ */
+using RequestMessage = std::variant<
+							Request::Version,
+							Request::Auth,
+							Request::Flush,
+							Request::Attach,
+							Request::Walk,
+							Request::Open,
+							Request::Create,
+							Request::Read,
+							Request::Write,
+							Request::Clunk,
+							Request::Remove,
+							Request::Stat,
+							Request::WStat
+							>;
+
+/**
+ * Type representing a response message of 9P2000 dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::ResponseMessage for a variant of all messages.
+ */
+using ResponseMessage = std::variant<
+							Response::Version,
+							Response::Auth,
+							Response::Attach,
+							Response::Error,
+							Response::Flush,
+							Response::Walk,
+							Response::Open,
+							Response::Create,
+							Response::Read,
+							Response::Write,
+							Response::Clunk,
+							Response::Remove,
+							Response::Stat,
+							Response::WStat
+							>;
+
+
+/**
+ * Compile-time description of 9P2000 protocol dialect.
+ * Maps message op-codes to message types.
+ */
+struct Dialect {
+
+	/// Variant of request messages of the dialect.
+	using RequestMessage = _9P2000::RequestMessage;
+
+	/// Variant of response messages of the dialect.
+	using ResponseMessage = _9P2000::ResponseMessage;
+
+	/**
+	 * Get a string representation of the message name given the op-code.
+	 * @param messageType Message op-code to convert to a string.
+	 * @return A string representation of a given message code.
+	 */
+	static Solace::StringView messageName(Solace::byte messageType) noexcept {
+		return messageTypeToString(messageType);
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the request message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a request type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a request message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitRequestType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Request::Version>():	return f(MessageTypeTag<Request::Version>{});
+		case messageCodeOf<Request::Auth>():	return f(MessageTypeTag<Request::Auth>{});
+		case messageCodeOf<Request::Flush>():	return f(MessageTypeTag<Request::Flush>{});
+		case messageCodeOf<Request::Attach>():	return f(MessageTypeTag<Request::Attach>{});
+		case messageCodeOf<Request::Walk>():	return f(MessageTypeTag<Request::Walk>{});
+		case messageCodeOf<Request::Open>():	return f(MessageTypeTag<Request::Open>{});
+		case messageCodeOf<Request::Create>():	return f(MessageTypeTag<Request::Create>{});
+		case messageCodeOf<Request::Read>():	return f(MessageTypeTag<Request::Read>{});
+		case messageCodeOf<Request::Write>():	return f(MessageTypeTag<Request::Write>{});
+		case messageCodeOf<Request::Clunk>():	return f(MessageTypeTag<Request::Clunk>{});
+		case messageCodeOf<Request::Remove>():	return f(MessageTypeTag<Request::Remove>{});
+		case messageCodeOf<Request::Stat>():	return f(MessageTypeTag<Request::Stat>{});
+		case messageCodeOf<Request::WStat>():	return f(MessageTypeTag<Request::WStat>{});
+		default:
+			return unsupported();
+		}
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the response message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a response type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a response message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitResponseType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Response::Version>():	return f(MessageTypeTag<Response::Version>{});
+		case messageCodeOf<Response::Auth>():	return f(MessageTypeTag<Response::Auth>{});
+		case messageCodeOf<Response::Attach>():	return f(MessageTypeTag<Response::Attach>{});
+		case messageCodeOf<Response::Error>():	return f(MessageTypeTag<Response::Error>{});
+		case messageCodeOf<Response::Flush>():	return f(MessageTypeTag<Response::Flush>{});
+		case messageCodeOf<Response::Walk>():	return f(MessageTypeTag<Response::Walk>{});
+		case messageCodeOf<Response::Open>():	return f(MessageTypeTag<Response::Open>{});
+		case messageCodeOf<Response::Create>():	return f(MessageTypeTag<Response::Create>{});
+		case messageCodeOf<Response::Read>():	return f(MessageTypeTag<Response::Read>{});
+		case messageCodeOf<Response::Write>():	return f(MessageTypeTag<Response::Write>{});
+		case messageCodeOf<Response::Clunk>():	return f(MessageTypeTag<Response::Clunk>{});
+		case messageCodeOf<Response::Remove>():	return f(MessageTypeTag<Response::Remove>{});
+		case messageCodeOf<Response::Stat>():	return f(MessageTypeTag<Response::Stat>{});
+		case messageCodeOf<Response::WStat>():	return f(MessageTypeTag<Response::WStat>{});
+		default:
+			return unsupported();
+		}
+	}
+};
+
+}  // namespace _9P2000
+
+namespace _9P2000U {
+
+/**
+ * Type representing a request message of 9P2000.u dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::RequestMessage for a variant of all messages.
+ */
+using RequestMessage = std::variant<
+							::styxe::Request::Version,
+							_9P2000U::Request::Auth,
+							::styxe::Request::Flush,
+							_9P2000U::Request::Attach,
+							::styxe::Request::Walk,
+							::styxe::Request::Open,
+							_9P2000U::Request::Create,
+							::styxe::Request::Read,
+							::styxe::Request::Write,
+							::styxe::Request::Clunk,
+							::styxe::Request::Remove,
+							::styxe::Request::Stat,
+							_9P2000U::Request::WStat
+							>;
+
+/**
+ * Type representing a response message of 9P2000.u dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::ResponseMessage for a variant of all messages.
+ */
+using ResponseMessage = std::variant<
+							::styxe::Response::Version,
+							::styxe::Response::Auth,
+							::styxe::Response::Attach,
+							_9P2000U::Response::Error,
+							::styxe::Response::Flush,
+							::styxe::Response::Walk,
+							::styxe::Response::Open,
+							::styxe::Response::Create,
+							::styxe::Response::Read,
+							::styxe::Response::Write,
+							::styxe::Response::Clunk,
+							::styxe::Response::Remove,
+							_9P2000U::Response::Stat,
+							::styxe::Response::WStat
+							>;
+
+
+/**
+ * Compile-time description of 9P2000.u protocol dialect.
+ * Maps message op-codes to message types. Messages not redefined by this extension are those of 9P2000.
+ */
+struct Dialect {
+
+	/// Variant of request messages of the dialect.
+	using RequestMessage = _9P2000U::RequestMessage;
+
+	/// Variant of response messages of the dialect.
+	using ResponseMessage = _9P2000U::ResponseMessage;
+
+	/**
+	 * Get a string representation of the message name given the op-code.
+	 * @param messageType Message op-code to convert to a string.
+	 * @return A string representation of a given message code.
+	 */
+	static Solace::StringView messageName(Solace::byte messageType) noexcept {
+		return messageTypeToString(messageType);
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the request message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a request type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a request message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitRequestType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Request::Auth>():	return f(MessageTypeTag<Request::Auth>{});
+		case messageCodeOf<Request::Attach>():	return f(MessageTypeTag<Request::Attach>{});
+		case messageCodeOf<Request::Create>():	return f(MessageTypeTag<Request::Create>{});
+		case messageCodeOf<Request::WStat>():	return f(MessageTypeTag<Request::WStat>{});
+		default:
+			return _9P2000::Dialect::visitRequestType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the response message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a response type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a response message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitResponseType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Response::Error>():	return f(MessageTypeTag<Response::Error>{});
+		case messageCodeOf<Response::Stat>():	return f(MessageTypeTag<Response::Stat>{});
+		default:
+			return _9P2000::Dialect::visitResponseType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+};
+
+}  // namespace _9P2000U
+
+namespace _9P2000E {
+
+/**
+ * Type representing a request message of 9P2000.e dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::RequestMessage for a variant of all messages.
+ */
+using RequestMessage = std::variant<
+							::styxe::Request::Version,
+							::styxe::Request::Auth,
+							::styxe::Request::Flush,
+							::styxe::Request::Attach,
+							::styxe::Request::Walk,
+							::styxe::Request::Open,
+							::styxe::Request::Create,
+							::styxe::Request::Read,
+							::styxe::Request::Write,
+							::styxe::Request::Clunk,
+							::styxe::Request::Remove,
+							::styxe::Request::Stat,
+							::styxe::Request::WStat,
+							_9P2000E::Request::Session,
+							_9P2000E::Request::ShortRead,
+							_9P2000E::Request::ShortWrite
+							>;
+
+/**
+ * Type representing a response message of 9P2000.e dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::ResponseMessage for a variant of all messages.
+ */
+using ResponseMessage = std::variant<
+							::styxe::Response::Version,
+							::styxe::Response::Auth,
+							::styxe::Response::Attach,
+							::styxe::Response::Error,
+							::styxe::Response::Flush,
+							::styxe::Response::Walk,
+							::styxe::Response::Open,
+							::styxe::Response::Create,
+							::styxe::Response::Read,
+							::styxe::Response::Write,
+							::styxe::Response::Clunk,
+							::styxe::Response::Remove,
+							::styxe::Response::Stat,
+							::styxe::Response::WStat,
+							_9P2000E::Response::Session,
+							_9P2000E::Response::ShortRead,
+							_9P2000E::Response::ShortWrite
+							>;
+
+
+/**
+ * Compile-time description of 9P2000.e protocol dialect.
+ * Maps message op-codes to message types. Messages not defined by this extension are those of 9P2000.
+ */
+struct Dialect {
+
+	/// Variant of request messages of the dialect.
+	using RequestMessage = _9P2000E::RequestMessage;
+
+	/// Variant of response messages of the dialect.
+	using ResponseMessage = _9P2000E::ResponseMessage;
+
+	/**
+	 * Get a string representation of the message name given the op-code.
+	 * @param messageType Message op-code to convert to a string.
+	 * @return A string representation of a given message code.
+	 */
+	static Solace::StringView messageName(Solace::byte messageType) noexcept {
+		return messageTypeToString(messageType);
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the request message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a request type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a request message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitRequestType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Request::Session>():	return f(MessageTypeTag<Request::Session>{});
+		case messageCodeOf<Request::ShortRead>():	return f(MessageTypeTag<Request::ShortRead>{});
+		case messageCodeOf<Request::ShortWrite>():	return f(MessageTypeTag<Request::ShortWrite>{});
+		default:
+			return _9P2000::Dialect::visitRequestType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the response message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a response type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a response message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitResponseType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Response::Session>():	return f(MessageTypeTag<Response::Session>{});
+		case messageCodeOf<Response::ShortRead>():	return f(MessageTypeTag<Response::ShortRead>{});
+		case messageCodeOf<Response::ShortWrite>():	return f(MessageTypeTag<Response::ShortWrite>{});
+		default:
+			return _9P2000::Dialect::visitResponseType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+};
+
+}  // namespace _9P2000E
+
+namespace _9P2000L {
+
+/**
+ * Type representing a request message of 9P2000.L dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::RequestMessage for a variant of all messages.
+ */
+using RequestMessage = std::variant<
+							::styxe::Request::Version,
+							_9P2000U::Request::Auth,
+							::styxe::Request::Flush,
+							_9P2000U::Request::Attach,
+							::styxe::Request::Walk,
+							::styxe::Request::Open,
+							_9P2000U::Request::Create,
+							::styxe::Request::Read,
+							::styxe::Request::Write,
+							::styxe::Request::Clunk,
+							::styxe::Request::Remove,
+							::styxe::Request::Stat,
+							_9P2000U::Request::WStat,
+							_9P2000L::Request::StatFS,
+							_9P2000L::Request::LOpen,
+							_9P2000L::Request::LCreate,
+							_9P2000L::Request::Symlink,
+							_9P2000L::Request::MkNode,
+							_9P2000L::Request::Rename,
+							_9P2000L::Request::ReadLink,
+							_9P2000L::Request::GetAttr,
+							_9P2000L::Request::SetAttr,
+							_9P2000L::Request::XAttrWalk,
+							_9P2000L::Request::XAttrCreate,
+							_9P2000L::Request::ReadDir,
+							_9P2000L::Request::FSync,
+							_9P2000L::Request::Lock,
+							_9P2000L::Request::GetLock,
+							_9P2000L::Request::Link,
+							_9P2000L::Request::MkDir,
+							_9P2000L::Request::RenameAt,
+							_9P2000L::Request::UnlinkAt
+							>;
+
+/**
+ * Type representing a response message of 9P2000.L dialect.
+ * Only holds message types that can be parsed in this dialect,
+ * @see styxe::ResponseMessage for a variant of all messages.
+ */
+using ResponseMessage = std::variant<
+							::styxe::Response::Version,
+							::styxe::Response::Auth,
+							::styxe::Response::Attach,
+							_9P2000U::Response::Error,
+							::styxe::Response::Flush,
+							::styxe::Response::Walk,
+							::styxe::Response::Open,
+							::styxe::Response::Create,
+							::styxe::Response::Read,
+							::styxe::Response::Write,
+							::styxe::Response::Clunk,
+							::styxe::Response::Remove,
+							_9P2000U::Response::Stat,
+							::styxe::Response::WStat,
+							_9P2000L::Response::LError,
+							_9P2000L::Response::StatFS,
+							_9P2000L::Response::LOpen,
+							_9P2000L::Response::LCreate,
+							_9P2000L::Response::Symlink,
+							_9P2000L::Response::MkNode,
+							_9P2000L::Response::Rename,
+							_9P2000L::Response::ReadLink,
+							_9P2000L::Response::GetAttr,
+							_9P2000L::Response::SetAttr,
+							_9P2000L::Response::XAttrWalk,
+							_9P2000L::Response::XAttrCreate,
+							_9P2000L::Response::ReadDir,
+							_9P2000L::Response::FSync,
+							_9P2000L::Response::Lock,
+							_9P2000L::Response::GetLock,
+							_9P2000L::Response::Link,
+							_9P2000L::Response::MkDir,
+							_9P2000L::Response::RenameAt,
+							_9P2000L::Response::UnlinkAt
+							>;
+
+
+/**
+ * Compile-time description of 9P2000.L protocol dialect.
+ * Maps message op-codes to message types. Messages not defined by this extension are those of 9P2000.u.
+ */
+struct Dialect {
+
+	/// Variant of request messages of the dialect.
+	using RequestMessage = _9P2000L::RequestMessage;
+
+	/// Variant of response messages of the dialect.
+	using ResponseMessage = _9P2000L::ResponseMessage;
+
+	/**
+	 * Get a string representation of the message name given the op-code.
+	 * @param messageType Message op-code to convert to a string.
+	 * @return A string representation of a given message code.
+	 */
+	static Solace::StringView messageName(Solace::byte messageType) noexcept {
+		return messageTypeToString(messageType);
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the request message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a request type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a request message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitRequestType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Request::StatFS>():	return f(MessageTypeTag<Request::StatFS>{});
+		case messageCodeOf<Request::LOpen>():	return f(MessageTypeTag<Request::LOpen>{});
+		case messageCodeOf<Request::LCreate>():	return f(MessageTypeTag<Request::LCreate>{});
+		case messageCodeOf<Request::Symlink>():	return f(MessageTypeTag<Request::Symlink>{});
+		case messageCodeOf<Request::MkNode>():	return f(MessageTypeTag<Request::MkNode>{});
+		case messageCodeOf<Request::Rename>():	return f(MessageTypeTag<Request::Rename>{});
+		case messageCodeOf<Request::ReadLink>():	return f(MessageTypeTag<Request::ReadLink>{});
+		case messageCodeOf<Request::GetAttr>():	return f(MessageTypeTag<Request::GetAttr>{});
+		case messageCodeOf<Request::SetAttr>():	return f(MessageTypeTag<Request::SetAttr>{});
+		case messageCodeOf<Request::XAttrWalk>():	return f(MessageTypeTag<Request::XAttrWalk>{});
+		case messageCodeOf<Request::XAttrCreate>():	return f(MessageTypeTag<Request::XAttrCreate>{});
+		case messageCodeOf<Request::ReadDir>():	return f(MessageTypeTag<Request::ReadDir>{});
+		case messageCodeOf<Request::FSync>():	return f(MessageTypeTag<Request::FSync>{});
+		case messageCodeOf<Request::Lock>():	return f(MessageTypeTag<Request::Lock>{});
+		case messageCodeOf<Request::GetLock>():	return f(MessageTypeTag<Request::GetLock>{});
+		case messageCodeOf<Request::Link>():	return f(MessageTypeTag<Request::Link>{});
+		case messageCodeOf<Request::MkDir>():	return f(MessageTypeTag<Request::MkDir>{});
+		case messageCodeOf<Request::RenameAt>():	return f(MessageTypeTag<Request::RenameAt>{});
+		case messageCodeOf<Request::UnlinkAt>():	return f(MessageTypeTag<Request::UnlinkAt>{});
+		default:
+			return _9P2000U::Dialect::visitRequestType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+
+	/**
+	 * Invoke a callable with a type tag of the response message given the op-code.
+	 * @param type Message op-code.
+	 * @param f Callable invoked with MessageTypeTag<T> of a response type for the op-code.
+	 * @param unsupported Callable invoked if the op-code is not a response message of this dialect.
+	 * @return Result of the callable invoked.
+	 */
+	template<typename F, typename U>
+	static constexpr decltype(auto) visitResponseType(Solace::byte type, F&& f, U&& unsupported) {
+		switch (type) {
+		case messageCodeOf<Response::LError>():	return f(MessageTypeTag<Response::LError>{});
+		case messageCodeOf<Response::StatFS>():	return f(MessageTypeTag<Response::StatFS>{});
+		case messageCodeOf<Response::LOpen>():	return f(MessageTypeTag<Response::LOpen>{});
+		case messageCodeOf<Response::LCreate>():	return f(MessageTypeTag<Response::LCreate>{});
+		case messageCodeOf<Response::Symlink>():	return f(MessageTypeTag<Response::Symlink>{});
+		case messageCodeOf<Response::MkNode>():	return f(MessageTypeTag<Response::MkNode>{});
+		case messageCodeOf<Response::Rename>():	return f(MessageTypeTag<Response::Rename>{});
+		case messageCodeOf<Response::ReadLink>():	return f(MessageTypeTag<Response::ReadLink>{});
+		case messageCodeOf<Response::GetAttr>():	return f(MessageTypeTag<Response::GetAttr>{});
+		case messageCodeOf<Response::SetAttr>():	return f(MessageTypeTag<Response::SetAttr>{});
+		case messageCodeOf<Response::XAttrWalk>():	return f(MessageTypeTag<Response::XAttrWalk>{});
+		case messageCodeOf<Response::XAttrCreate>():	return f(MessageTypeTag<Response::XAttrCreate>{});
+		case messageCodeOf<Response::ReadDir>():	return f(MessageTypeTag<Response::ReadDir>{});
+		case messageCodeOf<Response::FSync>():	return f(MessageTypeTag<Response::FSync>{});
+		case messageCodeOf<Response::Lock>():	return f(MessageTypeTag<Response::Lock>{});
+		case messageCodeOf<Response::GetLock>():	return f(MessageTypeTag<Response::GetLock>{});
+		case messageCodeOf<Response::Link>():	return f(MessageTypeTag<Response::Link>{});
+		case messageCodeOf<Response::MkDir>():	return f(MessageTypeTag<Response::MkDir>{});
+		case messageCodeOf<Response::RenameAt>():	return f(MessageTypeTag<Response::RenameAt>{});
+		case messageCodeOf<Response::UnlinkAt>():	return f(MessageTypeTag<Response::UnlinkAt>{});
+		default:
+			return _9P2000U::Dialect::visitResponseType(type, std::forward<F>(f), std::forward<U>(unsupported));
+		}
+	}
+};
+
+}  // namespace _9P2000L
+
+}  // end of namespace styxe
+#endif  // STYXE_DIALECT_HPP
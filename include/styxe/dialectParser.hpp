@@ -0,0 +1,340 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_DIALECTPARSER_HPP
+#define STYXE_DIALECTPARSER_HPP
+
+#include "styxe/dialect.hpp"
+#include "styxe/messageParser.hpp"
+
+#include <solace/utils.hpp>  // mv<>
+
+#include <type_traits>
+#include <variant>  // std::in_place_type
+
+
+// Branch prediction hint for the parsers below, undefined at the end of this header.
+#if defined(__GNUC__)
+#define STYXE_LIKELY(expr) __builtin_expect(!!(expr), 1)
+#else
+#define STYXE_LIKELY(expr) (expr)
+#endif
+
+
+namespace styxe {
+
+/**
+ * Decode a message of a given type directly into a message variant.
+ * @param data Byte buffer to read message content from.
+ * @return Message variant holding decoded message or an error.
+ */
+template<typename T, typename MessageVariant>
+Result<MessageVariant>
+decodeMessageAs(Solace::ByteReader& data) {
+	// Note: single named return value, so that the message is decoded directly into the caller's storage.
+	Result<MessageVariant> result{Solace::types::okTag, Solace::in_place, std::in_place_type<T>};
+
+	auto decoded = data >> std::get<T>(*result);
+	if (!decoded) {
+		result = Result<MessageVariant>{Solace::types::errTag, decoded.moveError()};
+	}
+
+	return result;
+}
+
+
+/**
+ * Decode a message of a given type and pass it to a handler.
+ * @param data Byte buffer to read message content from.
+ * @param handler A callable to pass decoded message to.
+ * @return Void or an error if message can not be decoded.
+ */
+template<typename T, typename Handler>
+Result<void>
+decodeMessageWith(Solace::ByteReader& data, Handler&& handler) {
+	T message{};
+	auto decoded = data >> message;
+	if (!decoded) {
+		return decoded.moveError();
+	}
+
+	handler(static_cast<T const&>(message));
+
+	return Solace::Ok();
+}
+
+
+namespace detail {
+
+/// Trait to check if a type is one of the alternatives of a variant.
+template<typename T, typename Variant>
+struct IsAlternativeOf : std::false_type {};
+
+template<typename T, typename... Types>
+struct IsAlternativeOf<T, std::variant<Types...>> : std::disjunction<std::is_same<T, Types>...> {};
+
+
+/// Move a message held by a variant into a wider variant, that has all alternatives of the source one.
+template<typename Target, typename... Messages>
+Target widenMessage(std::variant<Messages...>&& message) {
+	static_assert(std::conjunction<IsAlternativeOf<Messages, Target>...>::value,
+				  "Target variant must have all message types of the source variant");
+
+	return std::visit([](auto&& m) noexcept -> Target {
+			return Target{std::in_place_type<std::decay_t<decltype(m)>>, Solace::mv(m)};
+		},
+		Solace::mv(message));
+}
+
+}  // namespace detail
+
+
+/**
+ * Convert a request message of a dialect into a variant of all request messages.
+ * Used to pass messages parsed by a dialect parser to code that handles messages of any dialect.
+ * @param message A request message of a dialect, for example _9P2000::RequestMessage.
+ * @return RequestMessage holding the same message.
+ */
+template<typename... Messages>
+RequestMessage toRequestMessage(std::variant<Messages...> message) {
+	return detail::widenMessage<RequestMessage>(Solace::mv(message));
+}
+
+
+/**
+ * Convert a response message of a dialect into a variant of all response messages.
+ * Used to pass messages parsed by a dialect parser to code that handles messages of any dialect.
+ * @param message A response message of a dialect, for example _9P2000::ResponseMessage.
+ * @return ResponseMessage holding the same message.
+ */
+template<typename... Messages>
+ResponseMessage toResponseMessage(std::variant<Messages...> message) {
+	return detail::widenMessage<ResponseMessage>(Solace::mv(message));
+}
+
+
+/**
+ * An implementation of 9p request message parser for a protocol dialect known at compile time.
+ *
+ * Unlike RequestParser, that selects protocol version at runtime and dispatches via a table of function pointers,
+ * messages are dispatched with a `switch` over dialect op-codes, that compiler can see through.
+ * Parsed messages are returned as a variant of request messages of the dialect only, such as _9P2000::RequestMessage,
+ * so that visitors only handle messages of the dialect. @see toRequestMessage to convert it to RequestMessage.
+ * @see RequestParser for details about lifetime of parsed messages.
+ *
+ * @tparam Dialect Protocol dialect. One of _9P2000::Dialect, _9P2000U::Dialect, _9P2000E::Dialect or
+ * _9P2000L::Dialect.
+ */
+template<typename Dialect>
+struct BasicRequestParser final :
+		public ParserBase {
+
+	/// Type representing a request message of the dialect.
+	using Message = typename Dialect::RequestMessage;
+
+	/**
+	 * Construct a new instance of the parser.
+	 * @param maxPayloadSize Maximum message paylaod size in bytes.
+	 */
+	constexpr explicit BasicRequestParser(size_type maxPayloadSize) noexcept
+		: ParserBase{maxPayloadSize, Dialect::messageName}
+	{}
+
+	/**
+	 * Parse 9P Request type message from a byte buffer.
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @return Resulting message if parsed successfully or an error otherwise.
+	 */
+	Result<Message>
+	parseRequest(MessageHeader header, Solace::ByteReader& data) const {
+		auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+		if (!isValid)
+			return isValid.moveError();
+
+		// Hot path: data transfer and walk requests make the bulk of traffic, reads the most.
+		if (STYXE_LIKELY(header.type == asByte(MessageType::TRead)))
+			return decodeMessageAs<Request::Read, Message>(data);
+		if (header.type == asByte(MessageType::TWrite))
+			return decodeMessageAs<Request::Write, Message>(data);
+		if (header.type == asByte(MessageType::TWalk))
+			return decodeMessageAs<Request::Walk, Message>(data);
+
+		return Dialect::visitRequestType(header.type,
+			[&data](auto type) -> Result<Message> {
+				using T = typename decltype(type)::type;
+				// Base dialect messages redefined by an extension are shadowed and never reached.
+				if constexpr (detail::IsAlternativeOf<T, Message>::value) {
+					return decodeMessageAs<T, Message>(data);
+				} else {
+					return getCannedError(CannedError::UnsupportedMessageType);
+				}
+			},
+			[]() -> Result<Message> {
+				return getCannedError(CannedError::UnsupportedMessageType);
+			});
+	}
+
+	/**
+	 * Parse 9P Request type message from a byte buffer and pass it directly to a handler.
+	 * Parsed message is not wrapped into RequestMessage variant, thus no variant is constructed, moved or visited.
+	 *
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @param handler A callable invoked as `handler(T const&)` with the parsed message.
+	 * It must accept any request type of the dialect, that is any alternative of `Message`.
+	 * Base dialect messages shadowed by an extension are never passed to the handler.
+	 * @return Void if message has been parsed and handled or an error otherwise.
+	 */
+	template<typename Handler>
+	Result<void>
+	parseRequest(MessageHeader header, Solace::ByteReader& data, Handler&& handler) const {
+		auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+		if (!isValid)
+			return isValid.moveError();
+
+		if (STYXE_LIKELY(header.type == asByte(MessageType::TRead)))
+			return decodeMessageWith<Request::Read>(data, handler);
+		if (header.type == asByte(MessageType::TWrite))
+			return decodeMessageWith<Request::Write>(data, handler);
+		if (header.type == asByte(MessageType::TWalk))
+			return decodeMessageWith<Request::Walk>(data, handler);
+
+		return Dialect::visitRequestType(header.type,
+			[&data, &handler](auto type) -> Result<void> {
+				using T = typename decltype(type)::type;
+				// Base dialect messages redefined by an extension are shadowed and never reached.
+				if constexpr (detail::IsAlternativeOf<T, Message>::value) {
+					return decodeMessageWith<T>(data, handler);
+				} else {
+					return getCannedError(CannedError::UnsupportedMessageType);
+				}
+			},
+			[]() -> Result<void> {
+				return getCannedError(CannedError::UnsupportedMessageType);
+			});
+	}
+};
+
+
+/**
+ * An implementation of 9p response message parser for a protocol dialect known at compile time.
+ *
+ * Unlike ResponseParser, that selects protocol version at runtime and dispatches via a table of function pointers,
+ * messages are dispatched with a `switch` over dialect op-codes, that compiler can see through.
+ * Parsed messages are returned as a variant of response messages of the dialect only, such as _9P2000::ResponseMessage,
+ * so that visitors only handle messages of the dialect. @see toResponseMessage to convert it to ResponseMessage.
+ * @see ResponseParser for details about lifetime of parsed messages.
+ *
+ * @tparam Dialect Protocol dialect. One of _9P2000::Dialect, _9P2000U::Dialect, _9P2000E::Dialect or
+ * _9P2000L::Dialect.
+ */
+template<typename Dialect>
+struct BasicResponseParser final :
+		public ParserBase {
+
+	/// Type representing a response message of the dialect.
+	using Message = typename Dialect::ResponseMessage;
+
+	/**
+	 * Construct a new instance of the parser.
+	 * @param maxPayloadSize Maximum message paylaod size in bytes.
+	 */
+	constexpr explicit BasicResponseParser(size_type maxPayloadSize) noexcept
+		: ParserBase{maxPayloadSize, Dialect::messageName}
+	{}
+
+	/**
+	 * Parse 9P Response type message from a byte buffer.
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @return Resulting message if parsed successfully or an error otherwise.
+	 */
+	Result<Message>
+	parseResponse(MessageHeader header, Solace::ByteReader& data) const {
+		auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+		if (!isValid)
+			return isValid.moveError();
+
+		// Hot path: data transfer and walk responses make the bulk of traffic, reads the most.
+		if (STYXE_LIKELY(header.type == asByte(MessageType::RRead)))
+			return decodeMessageAs<Response::Read, Message>(data);
+		if (header.type == asByte(MessageType::RWrite))
+			return decodeMessageAs<Response::Write, Message>(data);
+		if (header.type == asByte(MessageType::RWalk))
+			return decodeMessageAs<Response::Walk, Message>(data);
+
+		return Dialect::visitResponseType(header.type,
+			[&data](auto type) -> Result<Message> {
+				using T = typename decltype(type)::type;
+				// Base dialect messages redefined by an extension are shadowed and never reached.
+				if constexpr (detail::IsAlternativeOf<T, Message>::value) {
+					return decodeMessageAs<T, Message>(data);
+				} else {
+					return getCannedError(CannedError::UnsupportedMessageType);
+				}
+			},
+			[]() -> Result<Message> {
+				return getCannedError(CannedError::UnsupportedMessageType);
+			});
+	}
+
+	/**
+	 * Parse 9P Response type message from a byte buffer and pass it directly to a handler.
+	 * Parsed message is not wrapped into ResponseMessage variant, thus no variant is constructed, moved or visited.
+	 *
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @param handler A callable invoked as `handler(T const&)` with the parsed message.
+	 * It must accept any response type of the dialect, that is any alternative of `Message`.
+	 * Base dialect messages shadowed by an extension are never passed to the handler.
+	 * @return Void if message has been parsed and handled or an error otherwise.
+	 */
+	template<typename Handler>
+	Result<void>
+	parseResponse(MessageHeader header, Solace::ByteReader& data, Handler&& handler) const {
+		auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+		if (!isValid)
+			return isValid.moveError();
+
+		if (STYXE_LIKELY(header.type == asByte(MessageType::RRead)))
+			return decodeMessageWith<Response::Read>(data, handler);
+		if (header.type == asByte(MessageType::RWrite))
+			return decodeMessageWith<Response::Write>(data, handler);
+		if (header.type == asByte(MessageType::RWalk))
+			return decodeMessageWith<Response::Walk>(data, handler);
+
+		return Dialect::visitResponseType(header.type,
+			[&data, &handler](auto type) -> Result<void> {
+				using T = typename decltype(type)::type;
+				// Base dialect messages redefined by an extension are shadowed and never reached.
+				if constexpr (detail::IsAlternativeOf<T, Message>::value) {
+					return decodeMessageWith<T>(data, handler);
+				} else {
+					return getCannedError(CannedError::UnsupportedMessageType);
+				}
+			},
+			[]() -> Result<void> {
+				return getCannedError(CannedError::UnsupportedMessageType);
+			});
+	}
+};
+
+}  // end of namespace styxe
+
+#undef STYXE_LIKELY
+
+#endif  // STYXE_DIALECTPARSER_HPP
@@ -18,6 +18,8 @@
 #define STYXE_ENCODER_HPP
 
 
+#include "9p.hpp"  // WalkPath
+
 #include <solace/stringView.hpp>
 #include <solace/byteWriter.hpp>
 
@@ -66,6 +68,7 @@ size_type protocolSize(Solace::uint32 const& value) noexcept;
 size_type protocolSize(Solace::uint64 const& value) noexcept;
 size_type protocolSize(Solace::StringView const& value) noexcept;
 size_type protocolSize(Solace::MemoryView const& value) noexcept;
+size_type protocolSize(WalkPath const& value) noexcept;
 
 
 
@@ -45,6 +45,12 @@ enum class CannedError : int {
 	IllFormedHeader_TooBig,
 	NotEnoughData,
 	MoreThenExpectedData,
+	IllFormedWalkPath,
+	IllFormedWalkPath_TooLong,
+	NotEnoughSpace,
+	TagsExhausted,
+	UnexpectedTag,
+	UnexpectedResponseType,
 };
 
 /**
@@ -0,0 +1,144 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_FIXEDFRAME_HPP
+#define STYXE_FIXEDFRAME_HPP
+
+#include "styxe/messageSchema.hpp"
+#include "styxe/errorDomain.hpp"
+
+#include <solace/byteWriter.hpp>
+
+#include <array>
+#include <cstring>  // std::memcpy
+
+
+namespace styxe {
+
+namespace detail {
+
+/// Store an integral value in the little-endian byte order.
+template<typename T>
+constexpr Solace::byte* storeLE(Solace::byte* dest, T value) noexcept {
+	for (std::size_t i = 0; i < sizeof(T); ++i) {
+		dest[i] = static_cast<Solace::byte>(value >> (8 * i));
+	}
+
+	return dest + sizeof(T);
+}
+
+constexpr Solace::byte* storeLE(Solace::byte* dest, Qid const& value) noexcept {
+	dest = storeLE(dest, value.type);
+	dest = storeLE(dest, value.version);
+	return storeLE(dest, value.path);
+}
+
+template<typename T, std::size_t N>
+constexpr Solace::byte* storeLE(Solace::byte* dest, T const (&value)[N]) noexcept {
+	for (auto const& item : value) {
+		dest = storeLE(dest, item);
+	}
+
+	return dest;
+}
+
+}  // namespace detail
+
+
+/**
+ * Pre-encoded frame of a fixed size message.
+ *
+ * Frames of fixed size messages, such as RClunk, RFlush or Rsetattr that are just a header, or RWrite and Rlock with
+ * one small field, only differ in the tag and field values. Message header is encoded at compile time, so that
+ * writing such a message is a copy of a few bytes from a constant template with the tag and fields stamped in,
+ * without the checks and header updates done by MessageWriter.
+ *
+ * Example:
+ * @code
+ * FixedFrame<Response::Clunk>::write(dest, tag);
+ * FixedFrame<Response::Write>::write(dest, tag, Response::Write{bytesWritten});
+ * @endcode
+ */
+template<typename MessageType>
+struct FixedFrame {
+	static_assert(isFixedSize<MessageType>(), "Only fixed size messages can be pre-encoded");
+
+	/// Size of the frame in bytes, including message header.
+	static constexpr size_type kSize = messageSize<MessageType>();
+
+	/// Encoded frame bytes.
+	using Bytes = std::array<Solace::byte, kSize>;
+
+	/**
+	 * Encode a frame of a message.
+	 * @param tag Tag of the message.
+	 * @param message A message with field values to encode.
+	 * @return Encoded frame.
+	 */
+	static constexpr Bytes encode(Tag tag, MessageType const& message = {}) noexcept {
+		Bytes frame = kTemplate;
+		stamp(frame.data(), tag, message);
+
+		return frame;
+	}
+
+	/**
+	 * Write a frame of a message into an output stream.
+	 * @param dest An output stream to write the frame to.
+	 * @param tag Tag of the message.
+	 * @param message A message with field values to encode.
+	 * @return Void or an error if the stream has not enough space left.
+	 */
+	static Result<void> write(Solace::ByteWriter& dest, Tag tag, MessageType const& message = {}) {
+		if (dest.remaining() < kSize) {
+			return getCannedError(CannedError::NotEnoughSpace);
+		}
+
+		// Frame is stamped in place: building it on the stack and copying it over stalls on store forwarding.
+		auto frame = dest.viewRemaining().dataAddress();
+		std::memcpy(frame, kTemplate.data(), kSize);
+		stamp(frame, tag, message);
+
+		return dest.advance(kSize);
+	}
+
+	/// Frame template: message header with no tag and zeroed fields.
+	static constexpr Bytes kTemplate = [] {
+		Bytes frame{};
+		auto dest = detail::storeLE(frame.data(), kSize);
+		detail::storeLE(dest, messageCodeOf<MessageType>());
+		return frame;
+	}();
+
+private:
+
+	/// Store tag and field values into a frame that holds a copy of the template.
+	static constexpr void stamp(Solace::byte* frame, Tag tag, MessageType const& message) noexcept {
+		detail::storeLE(frame + kTagOffset, tag);
+		if constexpr (fixedSizeOf<MessageType>() != 0) {
+			auto dest = frame + headerSize();
+			forEachField(message, [&dest](char const*, auto const& value) {
+				dest = detail::storeLE(dest, value);
+			});
+		}
+	}
+
+	/// Offset of the tag in a message header.
+	static constexpr std::size_t kTagOffset = sizeof(MessageHeader::messageSize) + sizeof(MessageHeader::type);
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_FIXEDFRAME_HPP
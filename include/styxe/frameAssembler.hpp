@@ -0,0 +1,168 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_FRAMEASSEMBLER_HPP
+#define STYXE_FRAMEASSEMBLER_HPP
+
+#include "styxe/9p.hpp"
+#include "styxe/errorDomain.hpp"
+
+#include <solace/byteReader.hpp>
+#include <solace/byteWriter.hpp>
+#include <solace/result.hpp>
+
+
+namespace styxe {
+
+/**
+ * Incremental frame assembler for a stream of 9P messages.
+ *
+ * Data read from a stream socket does not respect message boundaries: a single read may contain many messages,
+ * and a single message may be spread over many reads. FrameAssembler accepts arbitrary chunks of such stream and
+ * yields each complete frame exactly once.
+ * Frames that are fully contained in a chunk are handed out as views into that chunk - no data is copied.
+ * Only a trailing partial frame is copied into a user provided staging buffer, where it is completed by the
+ * data of the following chunks.
+ *
+ * @note The assembler does not allocate memory. Staging buffer is provided by the user and must outlive the assembler.
+ * Views yielded for a frame are only valid for the duration of a callback.
+ *
+ * Example:
+ * @code
+ * FrameAssembler assembler{stagingBuffer, parser.maxMessageSize()};
+ * ...
+ * auto const bytesRead = recv(socket, buffer, bufferSize, 0);
+ * auto result = assembler.feed(wrapMemory(buffer, bytesRead), [&](MessageHeader header, ByteReader& payload) {
+ *     auto maybeRequest = parser.parseRequest(header, payload);
+ *     ...
+ * });
+ * @endcode
+ */
+struct FrameAssembler {
+
+	/**
+	 * Construct a new FrameAssembler.
+	 * @param buffer Staging buffer to assemble frames spread over several chunks.
+	 * @param maxMessageSize Maximum size of a frame, including header, as negotiated with a Version message.
+	 * Note that frames larger than the staging buffer are also rejected.
+	 */
+	FrameAssembler(Solace::MutableMemoryView buffer, size_type maxMessageSize) noexcept;
+
+	/**
+	 * Get maximum size of a frame accepted by this assembler.
+	 * @return Maximum size of a frame in bytes, including header.
+	 */
+	size_type maxMessageSize() const noexcept { return _maxMessageSize; }
+
+	/**
+	 * Get number of bytes of an incomplete frame held in the staging buffer.
+	 * @return Number of bytes staged. Zero if there is no partial frame pending.
+	 */
+	size_type pending() const noexcept { return _staging.position(); }
+
+	/**
+	 * Discard partial frame, if any. Used to resync after an error or when connection is reset.
+	 */
+	void reset() noexcept;
+
+	/**
+	 * Feed a chunk of a stream into the assembler.
+	 * Callback is invoked as `onFrame(MessageHeader header, Solace::ByteReader& payload)` for each complete frame
+	 * with payload limited to the frame, so it can be passed directly to a message parser.
+	 *
+	 * @param chunk A chunk of data read from a stream.
+	 * @param onFrame Callback invoked for each complete frame.
+	 * @return Error if an ill-formed frame header is encountered. The stream can not be resynced in that case
+	 * and the assembler must be reset.
+	 */
+	template<typename F>
+	Result<void> feed(Solace::MemoryView chunk, F&& onFrame) {
+		if (pending() > 0) {  // Complete a frame started by previous chunks first.
+			auto maybeRemainder = stage(chunk);
+			if (!maybeRemainder) {
+				return maybeRemainder.moveError();
+			}
+
+			chunk = *maybeRemainder;
+			if (!isStagedFrameComplete()) {
+				return Solace::Ok();
+			}
+
+			auto payload = stagedPayload();
+			onFrame(_header, payload);
+			reset();
+		}
+
+		while (chunk.size() >= headerSize()) {
+			auto maybeHeader = frameHeader(chunk);
+			if (!maybeHeader) {
+				return maybeHeader.moveError();
+			}
+
+			auto const header = *maybeHeader;
+			if (header.messageSize > chunk.size()) {
+				break;
+			}
+
+			Solace::ByteReader payload{chunk.slice(headerSize(), header.messageSize)};
+			onFrame(header, payload);
+			chunk = chunk.slice(header.messageSize, chunk.size());
+		}
+
+		// Whatever is left is the head of the next frame.
+		auto maybeRemainder = stage(chunk);
+		if (!maybeRemainder) {
+			return maybeRemainder.moveError();
+		}
+
+		return Solace::Ok();
+	}
+
+private:
+
+	/**
+	 * Read and validate frame header at the start of a view.
+	 * @param data View of a frame. Must be at least headerSize() bytes long.
+	 * @return Frame header or an error if header is not valid.
+	 */
+	Result<MessageHeader> frameHeader(Solace::MemoryView data) const;
+
+	/**
+	 * Copy bytes into the staging buffer up to the end of the frame being assembled.
+	 * @param chunk Data to stage.
+	 * @return Portion of the chunk that has not been staged.
+	 */
+	Result<Solace::MemoryView> stage(Solace::MemoryView chunk);
+
+	/**
+	 * Check if the staging buffer holds a complete frame.
+	 * @return True if the staged frame is complete.
+	 */
+	bool isStagedFrameComplete() const noexcept;
+
+	/**
+	 * Get a reader of the payload of a staged frame.
+	 * @return Reader limited to the payload of the staged frame.
+	 */
+	Solace::ByteReader stagedPayload() const noexcept;
+
+	Solace::ByteWriter	_staging;			/// Staging buffer for a partial frame.
+	size_type			_maxMessageSize;	/// Max size of a frame.
+	MessageHeader		_header;			/// Header of the staged frame, valid once header bytes are staged.
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_FRAMEASSEMBLER_HPP
@@ -0,0 +1,170 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_IOVECWRITER_HPP
+#define STYXE_IOVECWRITER_HPP
+
+#include "styxe/messageWriter.hpp"
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000e.hpp"
+
+#include <sys/uio.h>  // struct iovec
+
+
+namespace styxe {
+
+/**
+ * Scatter/gather message writer for messages that carry a data payload.
+ *
+ * Unlike MessageWriter, the payload is not copied into the output stream: only message header and fields preceding
+ * the payload, including payload size, are written. The payload is referenced by an `iovec` pointing directly
+ * at the caller's memory, so that a message is sent with a single `writev` or `sendmsg` call
+ * and payload bytes are not copied in user space.
+ *
+ * @note Payload memory is not owned by the writer and must remain valid and unchanged until the message is sent.
+ *
+ * Example:
+ * @code
+ * ResponseIoVecWriter writer{buffer, tag};
+ * writer << Response::Read{fileData};
+ * writev(socket, writer.ioVecs(), writer.ioVecCount());
+ * @endcode
+ */
+template<typename MessageTag>
+struct IoVecWriter {
+
+	/// Maximum number of io vectors a message is made of: header with fixed fields followed by a payload.
+	static constexpr int kMaxIoVecs = 2;
+
+	/**
+	 * Construct a new IoVecWriter.
+	 * @param dest A byte writer stream where message header and fields are written.
+	 * @param messageTag Tag of the message being created.
+	 */
+	constexpr IoVecWriter(Solace::ByteWriter& dest, Tag messageTag = kNoTag) noexcept
+		: _writer{dest, messageTag}
+		, _startPos{dest.position()}
+	{}
+
+	IoVecWriter(IoVecWriter const&) = delete;
+	IoVecWriter& operator= (IoVecWriter const&) = delete;
+
+	/**
+	 * Get formed message header.
+	 * @return Copy of the message header. Message size includes size of the payload.
+	 */
+	constexpr MessageHeader header() const noexcept { return _writer.header(); }
+
+	/**
+	 * Get message payload.
+	 * @return View of the payload memory referenced by the message.
+	 */
+	constexpr Solace::MemoryView payload() const noexcept { return _payload; }
+
+	/**
+	 * Set message type and write message header to the output stream.
+	 * Message size in the header accounts for the payload, that is not written into the stream.
+	 * @param fieldsSize Size in bytes of message fields written into the output stream after the header.
+	 * @param payload Message payload to be referenced by the last io vector.
+	 * @return styxe::Encoder to write message fields to.
+	 */
+	template<typename MsgType>
+	Encoder& messageTypeOf(size_type fieldsSize, Solace::MemoryView payload) {
+		_payload = payload;
+		return _writer.template messageTypeOf<MsgType>(fieldsSize + Solace::narrow_cast<size_type>(payload.size()));
+	}
+
+	/**
+	 * Get io vectors of the message.
+	 * First vector points to the message header and fields in the output stream, and the second one - if present -
+	 * to the payload.
+	 * @return Pointer to an array of ioVecCount() io vectors, suitable for `writev` and `sendmsg`.
+	 */
+	iovec const* ioVecs() noexcept {
+		auto& buffer = _writer.encoder().buffer();
+		auto const fields = buffer.viewWritten().slice(_startPos, buffer.position());
+
+		_ioVecs[0] = asIoVec(fields);
+		_ioVecs[1] = asIoVec(_payload);
+
+		return _ioVecs;
+	}
+
+	/**
+	 * Get number of io vectors of the message.
+	 * @return Number of io vectors, 1 if message has no payload.
+	 */
+	constexpr int ioVecCount() const noexcept { return _payload.empty() ? 1 : kMaxIoVecs; }
+
+private:
+
+	static iovec asIoVec(Solace::MemoryView data) noexcept {
+		// Note: iovec is used for output only, the memory is never written to.
+		return {const_cast<Solace::byte*>(data.dataAddress()), data.size()};
+	}
+
+	/// Message writer used to write header and fields.
+	MessageWriter<MessageTag>			_writer;
+
+	/// Position in the output stream where the message header starts.
+	Solace::ByteWriter::size_type const	_startPos;
+
+	/// Message payload, not copied into the output stream.
+	Solace::MemoryView					_payload{};
+
+	/// Io vectors of the message.
+	iovec								_ioVecs[kMaxIoVecs]{};
+};
+
+
+using RequestIoVecWriter = IoVecWriter<RequestTag>;
+using ResponseIoVecWriter = IoVecWriter<ResponseTag>;
+
+
+/**
+ * Write read response with data referenced by an io vector.
+ * @param writer A writer to write message to.
+ * @param message A message to write.
+ * @return Ref to the writer for fluency.
+ */
+ResponseIoVecWriter& operator<< (ResponseIoVecWriter& writer, Response::Read const& message);
+
+/**
+ * Write short read response with data referenced by an io vector.
+ * @param writer A writer to write message to.
+ * @param message A message to write.
+ * @return Ref to the writer for fluency.
+ */
+ResponseIoVecWriter& operator<< (ResponseIoVecWriter& writer, _9P2000E::Response::ShortRead const& message);
+
+/**
+ * Write write request with data referenced by an io vector.
+ * @param writer A writer to write message to.
+ * @param message A message to write.
+ * @return Ref to the writer for fluency.
+ */
+RequestIoVecWriter& operator<< (RequestIoVecWriter& writer, Request::Write const& message);
+
+/**
+ * Write short write request with data referenced by an io vector.
+ * @param writer A writer to write message to.
+ * @param message A message to write.
+ * @return Ref to the writer for fluency.
+ */
+RequestIoVecWriter& operator<< (RequestIoVecWriter& writer, _9P2000E::Request::ShortWrite const& message);
+
+}  // end of namespace styxe
+#endif  // STYXE_IOVECWRITER_HPP
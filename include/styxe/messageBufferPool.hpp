@@ -0,0 +1,258 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_MESSAGEBUFFERPOOL_HPP
+#define STYXE_MESSAGEBUFFERPOOL_HPP
+
+#include "styxe/messageSchema.hpp"  // messageSize
+#include "styxe/errorDomain.hpp"
+
+#include <solace/byteReader.hpp>
+#include <solace/byteWriter.hpp>
+#include <solace/memoryManager.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+namespace styxe {
+
+/**
+ * A pool of message buffers, sized to the negotiated maximum message size.
+ *
+ * Buffers are grouped into size classes: powers of 2 starting from kMinBufferSize, with the largest class
+ * being exactly the negotiated msize. A buffer for a message is picked from the smallest class that fits it,
+ * @see messageSize. Released buffers are kept on per-class free lists and reused, so once the pool is warmed up
+ * no memory is allocated in the request path.
+ *
+ * A pool is owned by a thread - typically an event loop - and buffers are only acquired on that thread.
+ * Buffers can be released on any thread: buffers released on other threads are pushed onto a lock-free list
+ * which the owner thread takes over once its own free list runs empty.
+ *
+ * @note The pool must outlive all buffers acquired from it.
+ *
+ * Example:
+ * @code
+ * MessageBufferPool pool{memoryManager, negotiatedMsize};
+ * auto buffer = pool.acquire(messageSize(response)).unwrap();
+ * auto dest = buffer.writer();
+ * ResponseWriter writer{dest, tag};
+ * writer << response;
+ * @endcode
+ */
+struct MessageBufferPool {
+
+	/// Size of the smallest buffer, enough for any fixed size message.
+	static constexpr size_type kMinBufferSize = 256;
+
+	/// Maximum number of size classes.
+	static constexpr size_type kMaxSizeClasses = 24;
+
+	/// Usage statistics of a size class.
+	struct Stats {
+		size_type	bufferSize{0};		//!< Size in bytes of buffers of the class.
+		size_type	allocated{0};		//!< Number of buffers allocated from the memory manager.
+		size_type	inUse{0};			//!< Number of buffers currently acquired.
+		size_type	highWaterMark{0};	//!< Maximum number of buffers acquired at once.
+	};
+
+	/// Header of a pooled memory block, followed by the buffer memory.
+	struct Block {
+		Block*		next;		//!< Next block in a free list.
+		size_type	sizeClass;	//!< Index of the size class of the block.
+	};
+
+	/**
+	 * Buffer acquired from a pool. Buffer is returned to the pool when destroyed.
+	 */
+	struct Buffer {
+
+		constexpr Buffer() noexcept = default;
+
+		constexpr Buffer(MessageBufferPool& pool, Block* block, Solace::MutableMemoryView memory) noexcept
+			: _pool{&pool}
+			, _block{block}
+			, _memory{memory}
+		{}
+
+		Buffer(Buffer const&) = delete;
+		Buffer& operator= (Buffer const&) = delete;
+
+		Buffer(Buffer&& rhs) noexcept
+			: _pool{std::exchange(rhs._pool, nullptr)}
+			, _block{std::exchange(rhs._block, nullptr)}
+			, _memory{std::exchange(rhs._memory, {})}
+		{}
+
+		Buffer& operator= (Buffer&& rhs) noexcept {
+			if (this != &rhs) {
+				reset();
+				_pool = std::exchange(rhs._pool, nullptr);
+				_block = std::exchange(rhs._block, nullptr);
+				_memory = std::exchange(rhs._memory, {});
+			}
+
+			return *this;
+		}
+
+		~Buffer() { reset(); }
+
+		/// @return True if the buffer holds memory.
+		constexpr bool empty() const noexcept { return _block == nullptr; }
+
+		/// @return Size of the buffer memory in bytes.
+		size_type capacity() const noexcept { return Solace::narrow_cast<size_type>(_memory.size()); }
+
+		/// @return Buffer memory.
+		Solace::MutableMemoryView view() noexcept { return _memory; }
+
+		/// @return Buffer memory.
+		Solace::MemoryView view() const noexcept { return _memory; }
+
+		/**
+		 * Get a writer to write a message into the buffer.
+		 * @return A byte writer over the whole buffer memory.
+		 */
+		Solace::ByteWriter writer() noexcept { return Solace::ByteWriter{_memory}; }
+
+		/**
+		 * Get a reader to read a message from the buffer.
+		 * @param size Number of bytes of the buffer that hold data.
+		 * @return A byte reader over the first size bytes of the buffer.
+		 */
+		Solace::ByteReader reader(size_type size) const { return Solace::ByteReader{view().slice(0, size)}; }
+
+		/// Return the buffer to the pool. The buffer is empty afterwards.
+		void reset() noexcept;
+
+	private:
+		MessageBufferPool*			_pool{nullptr};
+		Block*						_block{nullptr};
+		Solace::MutableMemoryView	_memory{};
+	};
+
+
+	/**
+	 * Construct a new pool.
+	 * @param memoryManager Memory manager to allocate buffers from.
+	 * @param maxMessageSize Negotiated maximum message size, that is the size of the largest buffer.
+	 */
+	MessageBufferPool(Solace::MemoryManager& memoryManager, size_type maxMessageSize);
+
+	MessageBufferPool(MessageBufferPool const&) = delete;
+	MessageBufferPool& operator= (MessageBufferPool const&) = delete;
+
+	/**
+	 * Get maximum message size the pool provides buffers for.
+	 * @return Size in bytes of the largest buffer.
+	 */
+	constexpr size_type maxMessageSize() const noexcept { return _maxMessageSize; }
+
+	/**
+	 * Get number of size classes.
+	 * @return Number of distinct buffer sizes.
+	 */
+	constexpr size_type sizeClassCount() const noexcept { return _nSizeClasses; }
+
+	/**
+	 * Get index of the smallest size class with buffers of at least a given size.
+	 * @param size Required buffer size in bytes. Must be no larger than maxMessageSize().
+	 * @return Index of the size class.
+	 */
+	size_type sizeClassOf(size_type size) const noexcept;
+
+	/**
+	 * Acquire a buffer of at least the given size.
+	 * @param size Required buffer size in bytes.
+	 * @return A buffer or an error if size exceeds max message size, or memory allocation failed.
+	 */
+	Result<Buffer> acquire(size_type size);
+
+	/**
+	 * Acquire a buffer large enough for any message.
+	 * Used to receive messages of unknown size.
+	 * @return A buffer of maxMessageSize() bytes or an error if memory allocation failed.
+	 */
+	Result<Buffer> acquire() { return acquire(_maxMessageSize); }
+
+	/**
+	 * Acquire a buffer to encode a message into.
+	 * @param message A message to acquire the buffer for.
+	 * @return A buffer large enough for the message or an error.
+	 */
+	template<typename MessageType>
+	Result<Buffer> acquireFor(MessageType const& message) { return acquire(messageSize(message)); }
+
+	/**
+	 * Get usage statistics of a size class.
+	 * @param sizeClass Index of the size class.
+	 * @return Statistics of the class.
+	 */
+	Stats stats(size_type sizeClass) const;
+
+	/**
+	 * Get maximum number of bytes held by acquired buffers at once.
+	 * @return High-water mark of the pool memory usage in bytes.
+	 */
+	constexpr Solace::uint64 highWaterBytes() const noexcept { return _highWaterBytes; }
+
+private:
+
+	/// Free lists and counters of a size class.
+	struct SizeClass {
+		size_type				bufferSize{0};			//!< Size of buffers of the class.
+		size_type				allocated{0};			//!< Number of blocks allocated.
+		size_type				acquired{0};			//!< Number of acquisitions.
+		size_type				released{0};			//!< Number of releases by the owner thread.
+		size_type				highWaterMark{0};		//!< Maximum number of buffers in use.
+		Block*					freeList{nullptr};		//!< Blocks released by the owner thread.
+		std::atomic<Block*>		remoteFreeList{nullptr};	//!< Blocks released by other threads.
+		std::atomic<size_type>	remoteReleased{0};		//!< Number of releases by other threads.
+
+		size_type inUse() const noexcept {
+			return acquired - released - remoteReleased.load(std::memory_order_relaxed);
+		}
+	};
+
+	/// Return a block to its free list.
+	void release(Block* block) noexcept;
+
+	/// Allocate a new block of a size class.
+	Result<Block*> allocate(size_type sizeClass);
+
+	/// Get buffer memory of a block.
+	Solace::MutableMemoryView memoryOf(Block* block) noexcept;
+
+	Solace::MemoryManager&					_memoryManager;
+	size_type const							_maxMessageSize;
+	size_type								_nSizeClasses{0};
+	std::thread::id const					_owner;
+
+	/// Bytes acquired and released by the owner thread, and bytes released by other threads.
+	Solace::uint64							_bytesAcquired{0};
+	Solace::uint64							_bytesReleased{0};
+	std::atomic<Solace::uint64>				_bytesRemoteReleased{0};
+
+	/// Maximum number of bytes held by acquired buffers at once.
+	Solace::uint64							_highWaterBytes{0};
+
+	SizeClass								_classes[kMaxSizeClasses];
+	std::vector<Solace::MemoryResource>		_memory;
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_MESSAGEBUFFERPOOL_HPP
@@ -117,12 +117,55 @@ using ResponseMessage = std::variant<
 							_9P2000L::Response::UnlinkAt
 							>;
 
+// Every response parsed is moved around in this variant, so keep it no larger than the biggest fixed size response.
+static_assert(sizeof(ResponseMessage) <= sizeof(_9P2000L::Response::GetAttr) + sizeof(void*),
+			  "ResponseMessage variant size budget exceeded");
+
+/**
+ * A message parsed from a frame together with the header of that frame.
+ * Used by batch parsing methods where a tag of each message must be preserved.
+ */
+template<typename MessageType>
+struct ParsedMessage {
+	MessageHeader	header;		//!< Header of the frame the message was parsed from.
+	MessageType		message;	//!< Parsed message.
+};
+
+/// Type of a request parsed by a batch parser.
+using ParsedRequest = ParsedMessage<RequestMessage>;
+
+/// Type of a response parsed by a batch parser.
+using ParsedResponse = ParsedMessage<ResponseMessage>;
+
+
+/**
+ * Get exact size of a request in the wire format, including message header.
+ * @param message A request to get the size of.
+ * @return Number of bytes required to encode the request.
+ */
+size_type messageSize(RequestMessage const& message) noexcept;
+
+/**
+ * Get exact size of a response in the wire format, including message header.
+ * @param message A response to get the size of.
+ * @return Number of bytes required to encode the response.
+ */
+size_type messageSize(ResponseMessage const& message) noexcept;
+
+
 using RequestParseFunc = Solace::Result<RequestMessage, Error> (*)(Solace::ByteReader& );
 using ResponseParseFunc = Solace::Result<ResponseMessage, Error> (*)(Solace::ByteReader& );
 
 using RequestParseTable = std::array<RequestParseFunc, 1 << 8*sizeof(MessageHeader::type)>;
 using ResponseParseTable = std::array<ResponseParseFunc, 1 << 8*sizeof(MessageHeader::type)>;
 
+/// Parse functions that emplace a parsed message into a caller provided variant.
+using RequestParseIntoFunc = Solace::Result<void, Error> (*)(Solace::ByteReader&, RequestMessage&);
+using ResponseParseIntoFunc = Solace::Result<void, Error> (*)(Solace::ByteReader&, ResponseMessage&);
+
+using RequestParseIntoTable = std::array<RequestParseIntoFunc, 1 << 8*sizeof(MessageHeader::type)>;
+using ResponseParseIntoTable = std::array<ResponseParseIntoFunc, 1 << 8*sizeof(MessageHeader::type)>;
+
 /// Type alias for message code -> StringView mapping.
 using VersionedNameMapper = Solace::StringView (*)(Solace::byte) noexcept;
 
@@ -185,6 +228,60 @@ struct ParserBase {
 	 */
 	size_type maxMessageSize() const noexcept { return headerSize() + _maxPayloadSize; }
 
+protected:
+
+	/**
+	 * Parse all complete frames in a buffer holding back-to-back messages.
+	 * Frame size declared in a header is only checked against max message size, as a payload of each frame is read
+	 * from a view limited to the frame.
+	 * @param data Byte buffer to read messages from.
+	 * @param parserTable A table of version specific opcode parser methods.
+	 * @param out Output iterator to write parsed messages to.
+	 * @return Offset of a trailing partial frame or the end of data if there is none.
+	 * In case of an error, data position is set to the start of the frame that failed to parse.
+	 */
+	template<typename MessageType, typename ParseTable, typename OutputIt>
+	Result<Solace::ByteReader::size_type>
+	parseFrames(Solace::ByteReader& data, ParseTable const& parserTable, OutputIt out) const {
+		while (data.remaining() >= headerSize()) {
+			auto const frameStart = data.position();
+			auto maybeHeader = parseMessageHeader(data);
+			if (!maybeHeader) {
+				data.position(frameStart);
+				return maybeHeader.moveError();
+			}
+
+			auto const header = *maybeHeader;
+			if (header.messageSize > maxMessageSize()) {
+				data.position(frameStart);
+				return getCannedError(CannedError::IllFormedHeader_TooBig);
+			}
+
+			if (header.payloadSize() > data.remaining()) {  // Trailing partial frame
+				data.position(frameStart);
+				break;
+			}
+
+			auto const payloadView = data.viewRemaining().slice(0, header.payloadSize());
+#if defined(__GNUC__)
+			// Next header immediately follows the payload: fetch it while the payload is being decoded.
+			__builtin_prefetch(payloadView.end());
+#endif
+			Solace::ByteReader payload{payloadView};
+			auto maybeMessage = parserTable[header.type](payload);
+			if (!maybeMessage) {
+				data.position(frameStart);
+				return maybeMessage.moveError();
+			}
+
+			data.advance(header.payloadSize());
+			*out = ParsedMessage<MessageType>{header, Solace::mv(*maybeMessage)};
+			++out;
+		}
+
+		return Solace::Ok(data.position());
+	}
+
 private:
 	size_type				_maxPayloadSize;		/// Initial value of the maximum message payload size in bytes.
 	VersionedNameMapper		_nameMapper;
@@ -203,6 +300,8 @@ private:
  * Message parser acts on an instance of the user provided Solace::ByteReader and any message data such as
  * name string or data read from a file is actually a pointer to the underlying ReadBuffer storage.
  * Thus it is user's responsibility to manage lifetime of that buffer.
+ * Messages that must outlive the buffer, for example when handed over to another thread, can be copied
+ * into an Arena, @see clone.
  * (That is not technically correct as current implementation does allocate memory when dealing with Solace::Path
  * objects as there is no currently availiable PathView version)
  *
@@ -216,10 +315,33 @@ struct ResponseParser final :
 	 * @param maxPayloadSize Maximum message paylaod size in bytes.
 	 * @param nameMapper A pointer to a map-function to convert message op-codes to message name string.
 	 * @param parserTable A table of version specific opcode parser methods.
+	 * Table is not copied and must outlive the parser. Normally it is a static table of the protocol version.
+	 */
+	ResponseParser(size_type maxPayloadSize,
+				   VersionedNameMapper nameMapper,
+				   ResponseParseTable const& parserTable) noexcept
+		: ParserBase{maxPayloadSize, nameMapper}
+		, _versionedResponseParser{&parserTable}
+	{}
+
+	/// Parser can not be constructed from a temporary table as it only keeps a pointer to the table.
+	ResponseParser(size_type maxPayloadSize, VersionedNameMapper nameMapper, ResponseParseTable&& parserTable) = delete;
+
+	/**
+	 * Construct a new instance of the parser that can parse messages directly into a caller provided variant.
+	 * @param maxPayloadSize Maximum message paylaod size in bytes.
+	 * @param nameMapper A pointer to a map-function to convert message op-codes to message name string.
+	 * @param parserTable A table of version specific opcode parser methods.
+	 * @param parseIntoTable A table of version specific opcode parser methods that emplace parsed messages.
+	 * Tables are not copied and must outlive the parser. Normally these are static tables of the protocol version.
 	 */
-	ResponseParser(size_type maxPayloadSize, VersionedNameMapper nameMapper, ResponseParseTable	parserTable) noexcept
+	ResponseParser(size_type maxPayloadSize,
+				   VersionedNameMapper nameMapper,
+				   ResponseParseTable const& parserTable,
+				   ResponseParseIntoTable const& parseIntoTable) noexcept
 		: ParserBase{maxPayloadSize, nameMapper}
-		, _versionedResponseParser{Solace::mv(parserTable)}
+		, _versionedResponseParser{&parserTable}
+		, _versionedResponseParserInto{&parseIntoTable}
 	{}
 
 	/**
@@ -233,8 +355,36 @@ struct ResponseParser final :
 	Result<ResponseMessage>
 	parseResponse(MessageHeader header, Solace::ByteReader& data) const;
 
+	/**
+	 * Parse 9P Response type message from a byte buffer into a caller provided variant.
+	 * Unlike the overload that returns a parsed message, the message is constructed in place of the previous
+	 * content of the variant and is not moved around. A variant can be reused to parse many messages.
+	 *
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @param out A variant to parse message into. Its content is unspecified if parsing failed.
+	 * @return Void if parsed successfully or an error otherwise.
+	 */
+	Result<void>
+	parseResponse(MessageHeader header, Solace::ByteReader& data, ResponseMessage& out) const;
+
+	/**
+	 * Parse all complete 9P Response messages from a buffer holding back-to-back frames.
+	 * This is a batch version of parseResponse used by a pipelining client to parse all responses received in one read.
+	 *
+	 * @param data Byte buffer to read messages from. On return, positioned at the start of a trailing partial frame.
+	 * @param out Output iterator to write ParsedResponse values to.
+	 * @return Offset of a trailing partial frame in the buffer if parsed successfully or an error otherwise.
+	 */
+	template<typename OutputIt>
+	Result<Solace::ByteReader::size_type>
+	parseResponses(Solace::ByteReader& data, OutputIt out) const {
+		return parseFrames<ResponseMessage>(data, *_versionedResponseParser, Solace::mv(out));
+	}
+
 private:
-	ResponseParseTable	_versionedResponseParser;  /// Parser V-table.
+	ResponseParseTable const*	_versionedResponseParser;  /// Parser V-table.
+	ResponseParseIntoTable const*	_versionedResponseParserInto{nullptr};  /// Optional parser table to emplace messages.
 };
 
 
@@ -250,6 +400,8 @@ private:
  * Message parser acts on an instance of the user provided Solace::ByteReader and any message data such as
  * name string or data read from a file is actually a pointer to the underlying ReadBuffer storage.
  * Thus it is user's responsibility to manage lifetime of that buffer.
+ * Messages that must outlive the buffer, for example when handed over to another thread, can be copied
+ * into an Arena, @see clone.
  * (That is not technically correct as current implementation does allocate memory when dealing with Solace::Path
  * objects as there is no currently availiable PathView version)
  *
@@ -263,10 +415,33 @@ struct RequestParser final :
 	 * @param maxPayloadSize Maximum message paylaod size in bytes.
 	 * @param nameMapper A pointer to a map-function to convert message op-codes to message name string.
 	 * @param parserTable A table of version specific opcode parser methods.
+	 * Table is not copied and must outlive the parser. Normally it is a static table of the protocol version.
+	 */
+	RequestParser(size_type maxPayloadSize,
+				  VersionedNameMapper nameMapper,
+				  RequestParseTable const& parserTable) noexcept
+		: ParserBase{maxPayloadSize, nameMapper}
+		, _versionedRequestParser{&parserTable}
+	{}
+
+	/// Parser can not be constructed from a temporary table as it only keeps a pointer to the table.
+	RequestParser(size_type maxPayloadSize, VersionedNameMapper nameMapper, RequestParseTable&& parserTable) = delete;
+
+	/**
+	 * Construct a new instance of the parser that can parse messages directly into a caller provided variant.
+	 * @param maxPayloadSize Maximum message paylaod size in bytes.
+	 * @param nameMapper A pointer to a map-function to convert message op-codes to message name string.
+	 * @param parserTable A table of version specific opcode parser methods.
+	 * @param parseIntoTable A table of version specific opcode parser methods that emplace parsed messages.
+	 * Tables are not copied and must outlive the parser. Normally these are static tables of the protocol version.
 	 */
-	RequestParser(size_type maxPayloadSize, VersionedNameMapper	nameMapper, RequestParseTable parserTable) noexcept
+	RequestParser(size_type maxPayloadSize,
+				  VersionedNameMapper nameMapper,
+				  RequestParseTable const& parserTable,
+				  RequestParseIntoTable const& parseIntoTable) noexcept
 		: ParserBase{maxPayloadSize, nameMapper}
-		, _versionedRequestParser{Solace::mv(parserTable)}
+		, _versionedRequestParser{&parserTable}
+		, _versionedRequestParserInto{&parseIntoTable}
 	{}
 
 	/**
@@ -280,8 +455,36 @@ struct RequestParser final :
 	Result<RequestMessage>
 	parseRequest(MessageHeader header, Solace::ByteReader& data) const;
 
+	/**
+	 * Parse 9P Request type message from a byte buffer into a caller provided variant.
+	 * Unlike the overload that returns a parsed message, the message is constructed in place of the previous
+	 * content of the variant and is not moved around. A variant can be reused to parse many messages.
+	 *
+	 * @param header Message header.
+	 * @param data Byte buffer to read message content from.
+	 * @param out A variant to parse message into. Its content is unspecified if parsing failed.
+	 * @return Void if parsed successfully or an error otherwise.
+	 */
+	Result<void>
+	parseRequest(MessageHeader header, Solace::ByteReader& data, RequestMessage& out) const;
+
+	/**
+	 * Parse all complete 9P Request messages from a buffer holding back-to-back frames.
+	 * This is a batch version of parseRequest used by a server to parse all requests received in one read.
+	 *
+	 * @param data Byte buffer to read messages from. On return, positioned at the start of a trailing partial frame.
+	 * @param out Output iterator to write ParsedRequest values to.
+	 * @return Offset of a trailing partial frame in the buffer if parsed successfully or an error otherwise.
+	 */
+	template<typename OutputIt>
+	Result<Solace::ByteReader::size_type>
+	parseRequests(Solace::ByteReader& data, OutputIt out) const {
+		return parseFrames<RequestMessage>(data, *_versionedRequestParser, Solace::mv(out));
+	}
+
 private:
-	RequestParseTable	_versionedRequestParser;   /// Parser 'V-table'.
+	RequestParseTable const*	_versionedRequestParser;   /// Parser 'V-table'.
+	RequestParseIntoTable const*	_versionedRequestParserInto{nullptr};  /// Optional parser table to emplace messages.
 };
 
 
@@ -312,6 +515,8 @@ createRequestParser(Solace::StringView version, size_type maxPayloadSize) noexce
 static_assert(std::is_move_assignable_v<ParserBase>,			"ParserBase should be movable");
 static_assert(std::is_move_assignable_v<ResponseParser>,		"ResponseParser should be movable");
 static_assert(std::is_move_assignable_v<RequestParser>,			"RequestParser should be movable");
+static_assert(sizeof(ResponseParser) <= 4*sizeof(void*),		"ResponseParser should not copy parser tables");
+static_assert(sizeof(RequestParser) <= 4*sizeof(void*),			"RequestParser should not copy parser tables");
 
 static_assert(std::is_move_assignable_v<RequestMessage>,		"RequestMessage should be movable");
 static_assert(std::is_move_assignable_v<ResponseMessage>,		"ResponseMessage should be movable");
@@ -0,0 +1,284 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_MESSAGESCHEMA_HPP
+#define STYXE_MESSAGESCHEMA_HPP
+
+#include "9p.hpp"
+#include "encoder.hpp"  // protocolSize
+
+#include <tuple>
+#include <type_traits>
+#include <utility>  // std::index_sequence
+
+
+namespace styxe {
+
+/**
+ * Description of a message field: field name and a pointer to a member holding field value.
+ */
+template<typename Class, typename T>
+struct FieldDescriptor {
+	/// Type of the field value.
+	using value_type = T;
+
+	char const*	name;		//!< Name of the field.
+	T Class::*	member;		//!< Pointer to the member holding field value.
+};
+
+/**
+ * Create a field descriptor.
+ * @param name Name of the field.
+ * @param member Pointer to the member holding field value.
+ * @return Field descriptor.
+ */
+template<typename Class, typename T>
+constexpr FieldDescriptor<Class, T> describeField(char const* name, T Class::* member) noexcept {
+	return {name, member};
+}
+
+
+/**
+ * Wire format schema of a message: ordered list of message fields, as a tuple of field descriptors.
+ * Fields are encoded in the order they are listed.
+ * Message encoding, decoding, size and printing are derived from the schema.
+ * Specialized for each message type using STYXE_MESSAGE_SCHEMA macro.
+ */
+template<typename MessageType>
+struct MessageSchema;
+
+
+/// Trait to check if a message type has a schema.
+template<typename T, typename = void>
+struct HasSchema : std::false_type {};
+
+template<typename T>
+struct HasSchema<T, std::void_t<decltype(MessageSchema<T>::fields)>> : std::true_type {};
+
+
+/// Size of a value in the wire format if the value has a fixed size, or 0 for variable length values.
+template<typename T>
+struct FixedWireSize : std::integral_constant<size_type, 0> {};
+
+template<>
+struct FixedWireSize<Solace::uint8> : std::integral_constant<size_type, sizeof(Solace::uint8)> {};
+
+template<>
+struct FixedWireSize<Solace::uint16> : std::integral_constant<size_type, sizeof(Solace::uint16)> {};
+
+template<>
+struct FixedWireSize<Solace::uint32> : std::integral_constant<size_type, sizeof(Solace::uint32)> {};
+
+template<>
+struct FixedWireSize<Solace::uint64> : std::integral_constant<size_type, sizeof(Solace::uint64)> {};
+
+template<>
+struct FixedWireSize<Qid> :
+		std::integral_constant<size_type, sizeof(Qid::type) + sizeof(Qid::version) + sizeof(Qid::path)> {};
+
+template<typename T, std::size_t N>
+struct FixedWireSize<T[N]> : std::integral_constant<size_type, N * FixedWireSize<T>::value> {};
+
+
+namespace detail {
+
+/// Tuple of field descriptors of a message.
+template<typename MessageType>
+using SchemaFields = std::remove_const_t<decltype(MessageSchema<MessageType>::fields)>;
+
+/// Type of a value of the I-th field of a message.
+template<typename MessageType, std::size_t I>
+using FieldType = typename std::tuple_element_t<I, SchemaFields<MessageType>>::value_type;
+
+/// Index sequence of the fields of a message.
+template<typename MessageType>
+using FieldIndices = std::make_index_sequence<std::tuple_size<SchemaFields<MessageType>>::value>;
+
+template<typename MessageType, typename F, std::size_t...I>
+constexpr void forEachField(MessageType& message, F& f, std::index_sequence<I...>) {
+	using Schema = MessageSchema<std::remove_const_t<MessageType>>;
+	(f(std::get<I>(Schema::fields).name, message.*(std::get<I>(Schema::fields).member)), ...);
+}
+
+template<typename MessageType, std::size_t...I>
+constexpr bool allFieldsFixed(std::index_sequence<I...>) noexcept {
+	return (true && ... && (FixedWireSize<FieldType<MessageType, I>>::value != 0));
+}
+
+template<typename MessageType, std::size_t...I>
+constexpr size_type fixedFieldsSize(std::index_sequence<I...>) noexcept {
+	return (size_type{0} + ... + FixedWireSize<FieldType<MessageType, I>>::value);
+}
+
+/// Class a pointer to member belongs to.
+template<typename T>
+struct MemberClass;
+
+template<typename Class, typename T>
+struct MemberClass<T Class::*> {
+	using type = Class;
+};
+
+template<typename A, typename B>
+constexpr bool isSameMember(A a, B b) noexcept {
+	if constexpr (std::is_same<A, B>::value) {
+		return a == b;
+	} else {
+		return false;
+	}
+}
+
+/// Index of a field of a message schema given a pointer to the member holding field value.
+template<typename MessageType, typename Member, std::size_t...I>
+constexpr std::size_t fieldIndex(Member member, std::index_sequence<I...>) noexcept {
+	bool found = false;
+	std::size_t index = 0;
+	((found = found || isSameMember(std::get<I>(MessageSchema<MessageType>::fields).member, member),
+	  index += found ? 0 : 1), ...);
+
+	return index;
+}
+
+}  // namespace detail
+
+
+/**
+ * Call a function for each field of a message, in the wire format order.
+ * @param message A message to iterate fields of.
+ * @param f A function invoked as `f(char const* name, value)` for each field.
+ */
+template<typename MessageType, typename F>
+constexpr void forEachField(MessageType& message, F&& f) {
+	detail::forEachField(message, f, detail::FieldIndices<std::remove_const_t<MessageType>>{});
+}
+
+
+/**
+ * Check if all fields of a message have fixed size.
+ * @return True if a message of this type always has the same size.
+ */
+template<typename MessageType>
+constexpr bool isFixedSize() noexcept {
+	return detail::allFieldsFixed<MessageType>(detail::FieldIndices<MessageType>{});
+}
+
+
+/**
+ * Get size of fixed size fields of a message.
+ * @return Size in bytes of all fixed size fields of a message, that is payload size of a fixed size message.
+ */
+template<typename MessageType>
+constexpr size_type fixedSizeOf() noexcept {
+	return detail::fixedFieldsSize<MessageType>(detail::FieldIndices<MessageType>{});
+}
+
+
+/**
+ * Get offset of a field in the message payload.
+ * Offset is only known upfront for fields that follow fixed size fields.
+ *
+ * Example:
+ * @code
+ * static_assert(fieldOffset<&Request::Walk::newfid>() == 4);
+ * @endcode
+ *
+ * @tparam Member Pointer to the member holding field value.
+ * @tparam MessageType Message the field belongs to. Must be given if the member is inherited from a base class.
+ * @return Offset in bytes of the field from the start of the message payload.
+ */
+template<auto Member, typename MessageType = typename detail::MemberClass<decltype(Member)>::type>
+constexpr size_type fieldOffset() noexcept {
+	constexpr auto index = detail::fieldIndex<MessageType>(Member, detail::FieldIndices<MessageType>{});
+	static_assert(index < std::tuple_size<detail::SchemaFields<MessageType>>::value,
+				  "Member is not a field of the message schema");
+	static_assert(detail::allFieldsFixed<MessageType>(std::make_index_sequence<index>{}),
+				  "Field offset is only known upfront if all preceding fields have fixed size");
+
+	return detail::fixedFieldsSize<MessageType>(std::make_index_sequence<index>{});
+}
+
+
+/**
+ * Get exact size of the message payload in the wire format, not including message header.
+ * @param message A message to get the size of.
+ * @return Number of bytes required to encode the message payload.
+ */
+template<typename MessageType>
+constexpr std::enable_if_t<HasSchema<MessageType>::value, size_type>
+protocolSize(MessageType const& message) noexcept {
+	if constexpr (isFixedSize<MessageType>()) {
+		return fixedSizeOf<MessageType>();
+	} else {
+		size_type result = 0;
+		forEachField(message, [&result](char const*, auto const& value) {
+			using ValueType = std::decay_t<decltype(value)>;
+			if constexpr (FixedWireSize<ValueType>::value != 0) {
+				result += FixedWireSize<ValueType>::value;
+			} else {
+				result += protocolSize(value);
+			}
+		});
+
+		return result;
+	}
+}
+
+
+/**
+ * Get exact size of a message in the wire format, including message header.
+ * Used to pick a buffer for a message, or to check if the message fits, before encoding it.
+ * @param message A message to get the size of.
+ * @return Number of bytes required to encode the message.
+ */
+template<typename MessageType>
+constexpr size_type messageSize(MessageType const& message) noexcept {
+	return headerSize() + protocolSize(message);
+}
+
+
+/**
+ * Get size of a fixed size message in the wire format, including message header.
+ * @return Number of bytes required to encode any message of this type.
+ */
+template<typename MessageType>
+constexpr size_type messageSize() noexcept {
+	static_assert(isFixedSize<MessageType>(), "Message size is only known upfront for fixed size messages");
+
+	return headerSize() + fixedSizeOf<MessageType>();
+}
+
+
+/// Describe a field of a message in STYXE_MESSAGE_SCHEMA.
+#define STYXE_FIELD(member) ::styxe::describeField(#member, &Message::member)
+
+/// Define a schema for a message type, listing message fields with STYXE_FIELD in the wire format order.
+#define STYXE_MESSAGE_SCHEMA(MessageType, ...) \
+	template<> \
+	struct MessageSchema<MessageType> { \
+		using Message = MessageType; \
+		static constexpr auto fields = std::make_tuple(__VA_ARGS__); \
+	}
+
+/// Define a schema for a message type that has no fields.
+#define STYXE_EMPTY_MESSAGE_SCHEMA(MessageType) \
+	template<> \
+	struct MessageSchema<MessageType> { \
+		using Message = MessageType; \
+		static constexpr std::tuple<> fields{}; \
+	}
+
+}  // end of namespace styxe
+#endif  // STYXE_MESSAGESCHEMA_HPP
@@ -0,0 +1,348 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_MESSAGEVIEW_HPP
+#define STYXE_MESSAGEVIEW_HPP
+
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000u.hpp"
+#include "styxe/9p2000L.hpp"
+
+#include <array>
+
+
+namespace styxe {
+
+struct WalkView;
+struct WStatView;
+namespace _9P2000U { struct WStatView; }
+namespace _9P2000L { struct GetAttrView; }
+
+/**
+ * Decode a lazy view of Request::Walk message.
+ * Path segments are validated and indexed in a single pass, fids are not decoded.
+ * @param data Byte stream to read message from.
+ * @param dest A view to initialize.
+ * @return Ref to the byte stream or Error if operation has failed.
+ */
+Solace::Result<Solace::ByteReader&, Error>
+operator>> (Solace::ByteReader& data, WalkView& dest);
+
+/**
+ * Decode a lazy view of Request::WStat message.
+ * Only the bounds of the message are checked, no fields are decoded.
+ * @param data Byte stream to read message from.
+ * @param dest A view to initialize.
+ * @return Ref to the byte stream or Error if operation has failed.
+ */
+Solace::Result<Solace::ByteReader&, Error>
+operator>> (Solace::ByteReader& data, WStatView& dest);
+
+/**
+ * Decode a lazy view of _9P2000U::Request::WStat message.
+ * Only the bounds of the message are checked, no fields are decoded.
+ * @param data Byte stream to read message from.
+ * @param dest A view to initialize.
+ * @return Ref to the byte stream or Error if operation has failed.
+ */
+Solace::Result<Solace::ByteReader&, Error>
+operator>> (Solace::ByteReader& data, _9P2000U::WStatView& dest);
+
+/**
+ * Decode a lazy view of _9P2000L::Response::GetAttr message.
+ * Only the size of the message is checked, no fields are decoded.
+ * @param data Byte stream to read message from.
+ * @param dest A view to initialize.
+ * @return Ref to the byte stream or Error if operation has failed.
+ */
+Solace::Result<Solace::ByteReader&, Error>
+operator>> (Solace::ByteReader& data, _9P2000L::GetAttrView& dest);
+
+
+/**
+ * Base class for lazy message views.
+ *
+ * A view keeps a reference to the payload of a message, that has been checked to hold a complete message once,
+ * when the view was decoded. Message fields are only decoded when accessed.
+ * This is useful for handlers, such as proxies, that only look at a few fields of a message.
+ *
+ * @note As with parsed messages, a view points into the message buffer. It is user's responsibility to manage
+ * lifetime of that buffer.
+ */
+struct MessageView {
+
+	/**
+	 * Get raw message payload this view refers to.
+	 * @return Memory view of the message payload.
+	 */
+	constexpr Solace::MemoryView payload() const noexcept { return _payload; }
+
+protected:
+
+	constexpr MessageView() noexcept = default;
+
+	constexpr explicit MessageView(Solace::MemoryView payload) noexcept
+		: _payload{payload}
+	{}
+
+	/**
+	 * Decode a field at a given offset of the payload.
+	 * @param offset Offset of the field in the payload.
+	 * @return Decoded value of the field.
+	 */
+	template<typename T>
+	T fieldAt(size_type offset) const {
+		T value{};
+		Solace::ByteReader reader{_payload.slice(offset, _payload.size())};
+		Decoder decoder{reader};
+		decoder >> value;  // Note: payload has been validated when the view was decoded.
+
+		return value;
+	}
+
+private:
+	Solace::MemoryView	_payload;  //!< Message payload.
+};
+
+
+/**
+ * Lazy view of Request::Walk message.
+ */
+struct WalkView final :
+		public MessageView {
+
+	WalkView() noexcept = default;
+
+	/// @return Fid of the directory where to start walk from.
+	Fid fid() const { return fieldAt<Fid>(kFidOffset); }
+
+	/// @return A client provided new fid representing resulting file.
+	Fid newfid() const { return fieldAt<Fid>(kNewFidOffset); }
+
+	/// @return Number of path segments to walk.
+	var_datum_size_type nSegments() const noexcept { return _path.size(); }
+
+	/// @return A path to walk from the fid.
+	WalkPath path() const noexcept { return _path.path(); }
+
+	/// @return Index of the path segments for O(1) access to each segment.
+	WalkPathIndex const& pathIndex() const noexcept { return _path; }
+
+private:
+	friend Solace::Result<Solace::ByteReader&, Error> styxe::operator>> (Solace::ByteReader& data, WalkView& dest);
+
+	WalkView(Solace::MemoryView payload, WalkPathIndex const& path) noexcept
+		: MessageView{payload}
+		, _path{path}
+	{}
+
+	static constexpr size_type kFidOffset = fieldOffset<&Request::Walk::fid, Request::Walk>();
+	static constexpr size_type kNewFidOffset = fieldOffset<&Request::Walk::newfid, Request::Walk>();
+
+	WalkPathIndex	_path;  //!< Path segments, indexed when the view is decoded.
+};
+
+
+/**
+ * Lazy view of Request::WStat message.
+ */
+struct WStatView :
+		public MessageView {
+
+	constexpr WStatView() noexcept = default;
+
+	/// @return Fid of the file to update stats on.
+	Fid fid() const { return fieldAt<Fid>(kFidOffset); }
+
+	/// @return Decode all of the stats in one go.
+	Stat stat() const { return fieldAt<Stat>(kStatOffset); }
+
+	/// @return Server type.
+	Solace::uint16 type() const { return fieldAt<Solace::uint16>(kTypeOffset); }
+
+	/// @return Server subtype.
+	Solace::uint32 dev() const { return fieldAt<Solace::uint32>(kDevOffset); }
+
+	/// @return Qid of the file.
+	Qid qid() const { return fieldAt<Qid>(kQidOffset); }
+
+	/// @return Permissions and flags.
+	Solace::uint32 mode() const { return fieldAt<Solace::uint32>(kModeOffset); }
+
+	/// @return Last read time.
+	Solace::uint32 atime() const { return fieldAt<Solace::uint32>(kATimeOffset); }
+
+	/// @return Last write time.
+	Solace::uint32 mtime() const { return fieldAt<Solace::uint32>(kMTimeOffset); }
+
+	/// @return Length of the file in bytes.
+	Solace::uint64 length() const { return fieldAt<Solace::uint64>(kLengthOffset); }
+
+	/// @return File name.
+	Solace::StringView name() const { return fieldAt<Solace::StringView>(kNameOffset); }
+
+	/// @return Owner name.
+	Solace::StringView uid() const { return fieldAt<Solace::StringView>(_stringOffsets[1]); }
+
+	/// @return Group name.
+	Solace::StringView gid() const { return fieldAt<Solace::StringView>(_stringOffsets[2]); }
+
+	/// @return Name of the user who last modified the file.
+	Solace::StringView muid() const { return fieldAt<Solace::StringView>(_stringOffsets[3]); }
+
+protected:
+	/// Number of strings of a stat: name, uid, gid, muid and, in 9P2000.u, extension.
+	static constexpr size_type kMaxStrings = 5;
+
+	/// Offsets of the strings of a stat, followed by the offset of the data after the last string.
+	using StringOffsets = std::array<size_type, kMaxStrings + 1>;
+
+	friend Solace::Result<Solace::ByteReader&, Error> styxe::operator>> (Solace::ByteReader& data, WStatView& dest);
+
+	constexpr WStatView(Solace::MemoryView payload, StringOffsets const& stringOffsets) noexcept
+		: MessageView{payload}
+		, _stringOffsets{stringOffsets}
+	{}
+
+	static constexpr size_type kFidOffset = fieldOffset<&Request::WStat::fid>();
+	static constexpr size_type kStatOffset = fieldOffset<&Request::WStat::stat>();
+	static constexpr size_type kTypeOffset = kStatOffset + FixedWireSize<decltype(Stat::size)>::value;
+	static constexpr size_type kDevOffset = kTypeOffset + FixedWireSize<decltype(Stat::type)>::value;
+	static constexpr size_type kQidOffset = kDevOffset + FixedWireSize<decltype(Stat::dev)>::value;
+	static constexpr size_type kModeOffset = kQidOffset + FixedWireSize<decltype(Stat::qid)>::value;
+	static constexpr size_type kATimeOffset = kModeOffset + FixedWireSize<decltype(Stat::mode)>::value;
+	static constexpr size_type kMTimeOffset = kATimeOffset + FixedWireSize<decltype(Stat::atime)>::value;
+	static constexpr size_type kLengthOffset = kMTimeOffset + FixedWireSize<decltype(Stat::mtime)>::value;
+	static constexpr size_type kNameOffset = kLengthOffset + FixedWireSize<decltype(Stat::length)>::value;
+
+	StringOffsets	_stringOffsets{};  //!< Offsets of the stat strings, found when the view is decoded.
+};
+
+
+
+namespace _9P2000U {
+
+/**
+ * Lazy view of _9P2000U::Request::WStat message.
+ */
+struct WStatView final :
+		public ::styxe::WStatView {
+
+	constexpr WStatView() noexcept = default;
+
+	/// @return Decode all of the stats in one go.
+	StatEx stat() const { return fieldAt<StatEx>(kStatOffset); }
+
+	/// @return UNIX extension data about special files.
+	Solace::StringView extension() const { return fieldAt<Solace::StringView>(_stringOffsets[4]); }
+
+	/// @return Numeric id of the user who owns the file.
+	Solace::uint32 n_uid() const { return fieldAt<Solace::uint32>(numericIdOffset(0)); }
+
+	/// @return Numeric id of the group associated with the file.
+	Solace::uint32 n_gid() const { return fieldAt<Solace::uint32>(numericIdOffset(1)); }
+
+	/// @return Numeric id of the user who last modified the file.
+	Solace::uint32 n_muid() const { return fieldAt<Solace::uint32>(numericIdOffset(2)); }
+
+private:
+	friend Solace::Result<Solace::ByteReader&, Error>
+	styxe::operator>> (Solace::ByteReader& data, _9P2000U::WStatView& dest);
+
+	constexpr WStatView(Solace::MemoryView payload, StringOffsets const& stringOffsets) noexcept
+		: ::styxe::WStatView{payload, stringOffsets}
+	{}
+
+	size_type numericIdOffset(size_type index) const noexcept {
+		return _stringOffsets[kMaxStrings] + index * FixedWireSize<Solace::uint32>::value;
+	}
+};
+
+}  // namespace _9P2000U
+
+
+
+namespace _9P2000L {
+
+/**
+ * Lazy view of _9P2000L::Response::GetAttr message.
+ */
+struct GetAttrView final :
+		public MessageView {
+
+	constexpr GetAttrView() noexcept = default;
+
+	/// @return Bitmask indicating which fields are valid. @see AttributesMask
+	Solace::uint64 valid() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::valid>()); }
+	/// @return Qid of the attributes object.
+	Qid qid() const { return fieldAt<Qid>(fieldOffset<&Message::qid>()); }
+	/// @return Protection.
+	Solace::uint32 mode() const { return fieldAt<Solace::uint32>(fieldOffset<&Message::mode>()); }
+	/// @return User ID of owner.
+	Solace::uint32 uid() const { return fieldAt<Solace::uint32>(fieldOffset<&Message::uid>()); }
+	/// @return Group ID of owner.
+	Solace::uint32 gid() const { return fieldAt<Solace::uint32>(fieldOffset<&Message::gid>()); }
+	/// @return Number of hard links.
+	Solace::uint64 nlink() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::nlink>()); }
+	/// @return Device ID (if special file).
+	Solace::uint64 rdev() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::rdev>()); }
+	/// @return Total size, in bytes.
+	Solace::uint64 size() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::size>()); }
+	/// @return Blocksize for file system I/O.
+	Solace::uint64 blksize() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::blksize>()); }
+	/// @return Number of 512B blocks allocated.
+	Solace::uint64 blocks() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::blocks>()); }
+	/// @return Time of last access.
+	Solace::uint64 atime_sec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::atime_sec>()); }
+	/// @return Time of last access - nano-second portion.
+	Solace::uint64 atime_nsec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::atime_nsec>()); }
+	/// @return Time of last modification.
+	Solace::uint64 mtime_sec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::mtime_sec>()); }
+	/// @return Time of last modification - nano-second portion.
+	Solace::uint64 mtime_nsec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::mtime_nsec>()); }
+	/// @return Time of last status change.
+	Solace::uint64 ctime_sec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::ctime_sec>()); }
+	/// @return Time of last status change - nano-second portion.
+	Solace::uint64 ctime_nsec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::ctime_nsec>()); }
+	/// @return Reserved for future use.
+	Solace::uint64 btime_sec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::btime_sec>()); }
+	/// @return Reserved for future use.
+	Solace::uint64 btime_nsec() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::btime_nsec>()); }
+	/// @return Reserved for future use.
+	Solace::uint64 gen() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::gen>()); }
+	/// @return Reserved for future use.
+	Solace::uint64 data_version() const { return fieldAt<Solace::uint64>(fieldOffset<&Message::data_version>()); }
+
+	/// Size of the message payload in bytes.
+	static constexpr size_type kPayloadSize = fixedSizeOf<Response::GetAttr>();
+
+private:
+	friend Solace::Result<Solace::ByteReader&, Error>
+	styxe::operator>> (Solace::ByteReader& data, _9P2000L::GetAttrView& dest);
+
+	constexpr explicit GetAttrView(Solace::MemoryView payload) noexcept
+		: MessageView{payload}
+	{}
+
+	using Message = Response::GetAttr;
+
+	static_assert(isFixedSize<Message>(), "Rgetattr has fixed size payload");
+};
+
+}  // namespace _9P2000L
+
+}  // end of namespace styxe
+#endif  // STYXE_MESSAGEVIEW_HPP
@@ -18,6 +18,7 @@
 #define STYXE_MESSAGEWRITER_HPP
 
 #include "encoder.hpp"
+#include "errorDomain.hpp"
 #include "9p.hpp"
 
 
@@ -54,8 +55,37 @@ struct MessageWriterBase {
 	{}
 
 
-	/// Update message header with the actual number of bytes written so far.
-	void updateMessageSize();
+	/**
+	 * Update message header with the actual number of bytes written so far.
+	 * @note Does nothing if size updates are deferred, @see deferSizeUpdates.
+	 */
+	void updateMessageSize() {
+		if (!_deferSizeUpdates) {
+			writeMessageSize();
+		}
+	}
+
+	/**
+	 * Defer updates of the message size until the message is finished.
+	 * By default message header is re-written each time a field is appended to a message,
+	 * so that output buffer always holds a valid message. In deferred mode the header is written once, by finish().
+	 * @return Ref to this writer for fluency.
+	 */
+	MessageWriterBase& deferSizeUpdates() noexcept {
+		_deferSizeUpdates = true;
+		return *this;
+	}
+
+	/**
+	 * Check if message size updates are deferred until the message is finished.
+	 * @return True if the message size is only updated by finish().
+	 */
+	constexpr bool isSizeUpdateDeferred() const noexcept { return _deferSizeUpdates; }
+
+	/// Finish the message: write the final message size into the header.
+	void finish() {
+		writeMessageSize();
+	}
 
 
 	/** Get underlying data encoder
@@ -63,6 +93,14 @@ struct MessageWriterBase {
 	*/
    constexpr Encoder& encoder() noexcept { return _encoder; }
 
+   /**
+	* Get number of bytes of the message written to the output stream so far.
+	* @return Number of bytes written, including message header.
+	*/
+   size_type bytesWritten() noexcept {
+	   return Solace::narrow_cast<size_type>(_encoder.buffer().position() - _pos);
+   }
+
    /**
 	*  Get formed message header
 	* @return Copy of the message header.
@@ -83,6 +121,18 @@ struct MessageWriterBase {
 	   return messageType(messageCodeOf<MsgType>());
    }
 
+   /**
+	* Set message type and write message header with the final message size to the output stream.
+	* As the size of the message is known upfront, the header needs no update once payload is written.
+	* @param payloadSize Size of the message payload in bytes.
+	* @return styxe::Encoder to write payload data to.
+	*/
+   template<typename MsgType>
+   Encoder& messageTypeOf(size_type payloadSize) {
+	   _header.messageSize = headerSize() + payloadSize;
+	   return messageType(messageCodeOf<MsgType>());
+   }
+
    /**
 	* Set message type and write newly formed message header to the output stream.
 	* @param type Message type byte-code. @see MessageHeader::type
@@ -101,6 +151,9 @@ private:
    */
    Solace::ByteWriter& build();
 
+   /// Write the actual number of bytes written so far into the message header.
+   void writeMessageSize();
+
    /// Data encoder used to write data out
    Encoder							_encoder;
 
@@ -109,6 +162,9 @@ private:
 
    /// Message header
    MessageHeader					_header;
+
+   /// If true, message size is only written by finish().
+   bool								_deferSizeUpdates{false};
 };
 
 /**
@@ -167,6 +223,11 @@ struct PartialDataWriter {
 		_writer.updateMessageSize();
 	}
 
+	/**
+	 * Set size of the data written directly into the output buffer, @see viewRemainder.
+	 * @param dataSize Total size of the data. Must not exceed capacity of the output buffer.
+	 * @return Ref to the original message writer.
+	 */
 	MessageWriterBase& update(size_type dataSize);
 
 	/**
@@ -178,10 +239,34 @@ struct PartialDataWriter {
 
 	Solace::MutableMemoryView viewRemainder();
 
+	/**
+	 * Reserve space for data in the output buffer, to be filled in place. For example by `pread`, `preadv` or
+	 * an asynchronous read, so that data is not copied into the message.
+	 * Reserved space is limited by the remaining capacity of the output buffer and by the maximum message size.
+	 * @param maxBytes Maximum number of bytes to reserve, usually `count` of the read request.
+	 * @param maxMessageSize Maximum message size negotiated for the connection, @see ParserBase::maxMessageSize.
+	 * @return View of the output buffer to write at most min(maxBytes, maxMessageSize - message size) bytes into.
+	 */
+	Solace::MutableMemoryView reserve(size_type maxBytes, size_type maxMessageSize);
+
+	/**
+	 * Commit data written into the reserved space.
+	 * @param dataSize Number of bytes written into the view returned by reserve().
+	 * @return Void or an error if more data is committed than reserved.
+	 */
+	Result<void> commit(size_type dataSize);
+
+	/**
+	 * Finish the message: write the final data size and message size.
+	 * @return Ref to the original message writer.
+	 */
+	MessageWriterBase& finish();
+
 private:
 	MessageWriterBase&						_writer;
 	Solace::ByteWriter::size_type const		_segmentsPos;   //!< A position in the output stream where path segments start.
 	size_type								_dataSize{0};   //!< Total size of data written so far
+	size_type								_reserved{0};   //!< Size of the space reserved for data
 };
 
 
@@ -227,6 +312,12 @@ struct PartialPathWriter {
 	 */
 	void segment(Solace::StringView value);
 
+	/**
+	 * Finish the message: write the final number of path segments and message size.
+	 * @return Ref to the original message writer.
+	 */
+	RequestWriter& finish();
+
 protected:
 	RequestWriter&					_writer;  //!< Ref to the underlying writer object the data written to.
 
@@ -300,10 +391,34 @@ struct PartialStringWriter {
 	 */
 	MessageWriterBase& string(Solace::StringView value);
 
+	/**
+	 * Reserve space for string bytes in the output buffer, to be filled in place. For example by `readlink`.
+	 * Reserved space is limited by the remaining capacity of the output buffer, by the maximum message size
+	 * and by the maximum string length.
+	 * @param maxBytes Maximum number of bytes to reserve.
+	 * @param maxMessageSize Maximum message size negotiated for the connection, @see ParserBase::maxMessageSize.
+	 * @return View of the output buffer to write string bytes into.
+	 */
+	Solace::MutableMemoryView reserve(size_type maxBytes, size_type maxMessageSize);
+
+	/**
+	 * Commit string bytes written into the reserved space.
+	 * @param stringSize Number of bytes written into the view returned by reserve().
+	 * @return Void or an error if more bytes are committed than reserved.
+	 */
+	Result<void> commit(size_type stringSize);
+
+	/**
+	 * Finish the message: write the final string size and message size.
+	 * @return Ref to the original message writer.
+	 */
+	MessageWriterBase& finish();
+
 private:
 	MessageWriterBase&						_writer;
 	Solace::ByteWriter::size_type const		_segmentsPos;   //!< A position in the output stream where path segments start.
 	Solace::StringView::size_type			_dataSize{0};   //!< A position in the output stream where path segments start.
+	Solace::StringView::size_type			_reserved{0};   //!< Size of the space reserved for string bytes.
 };
 
 inline
@@ -319,5 +434,57 @@ PartialStringWriter& operator<< (PartialStringWriter& writer, Solace::StringView
 }
 
 
+/// Message writer partial for messages that include repeated qids.
+struct PartialQidWriter {
+
+	/**
+	 * Construct a new QidWriter.
+	 * @param writer A byte stream to write the resulting message to.
+	 */
+	explicit PartialQidWriter(ResponseWriter& writer) noexcept
+		: _writer{writer}
+		, _qidsPos{writer.encoder().buffer().position()}
+	{
+		_writer.encoder() << _nQids;
+		_writer.updateMessageSize();
+	}
+
+	/**
+	 * Get a reference to the underlying writer object
+	 * @return reference to the underlying writer object
+	 */
+	constexpr ResponseWriter& writer() noexcept { return  _writer; }
+
+	/**
+	 * Write next qid.
+	 * @param value A qid to be written.
+	 */
+	void qid(Qid const& value);
+
+	/**
+	 * Finish the message: write the final number of qids and message size.
+	 * @return Ref to the original message writer.
+	 */
+	ResponseWriter& finish();
+
+private:
+	ResponseWriter&						_writer;		//!< Ref to the underlying writer object the data written to.
+	Solace::ByteWriter::size_type const	_qidsPos;		//!< A position in the output stream where qids start.
+	var_datum_size_type					_nQids{0};		//!< Number of qids written
+};
+
+inline
+PartialQidWriter&& operator<< (PartialQidWriter&& writer, Qid const& value) {
+	writer.qid(value);
+	return Solace::mv(writer);
+}
+
+inline
+PartialQidWriter& operator<< (PartialQidWriter& writer, Qid const& value) {
+	writer.qid(value);
+	return writer;
+}
+
+
 }  // end of namespace styxe
 #endif  // STYXE_MESSAGEWRITER_HPP
@@ -0,0 +1,163 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_PAYLOADALIGNMENT_HPP
+#define STYXE_PAYLOADALIGNMENT_HPP
+
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000e.hpp"
+#include "styxe/messageSchema.hpp"
+
+#include <solace/mutableMemoryView.hpp>
+
+
+/**
+ * Helpers to place a message frame in a buffer so that the data payload of the message is aligned.
+ *
+ * Data payload of RRead starts 11 bytes and of TWrite 23 bytes into the frame, thus it is never aligned
+ * if the frame itself is. Direct IO, such as files opened with O_DIRECT, requires aligned memory.
+ * Starting a frame at an offset into a buffer, so that the payload lands on an alignment boundary, lets the payload
+ * be read from or written to a file directly, without a bounce buffer.
+ *
+ * Example, sending side:
+ * @code
+ * ByteWriter dest{alignPayload(buffer, payloadOffset<Response::Read>()).unwrap()};
+ * ResponseWriter writer{dest, tag};
+ * auto dataWriter = writer << Response::Partial::Read{};
+ * auto view = dataWriter.reserve(request.count, msize);  // view.dataAddress() is aligned
+ * dataWriter.commit(pread(fd, view.dataAddress(), alignDown(view.size()), request.offset));
+ * send(socket, dest.viewWritten());  // Frame only, no padding
+ * @endcode
+ *
+ * Example, receiving side:
+ * @code
+ * auto header = parseMessageHeader(headerReader).unwrap();  // Header received first
+ * auto body = alignReceivedPayload(buffer, header).unwrap();
+ * recv(socket, body.dataAddress(), body.size());
+ * ByteReader reader{body};
+ * requestParser.parseRequest(header, reader);  // Write request data is aligned
+ * @endcode
+ */
+namespace styxe {
+
+/// Default payload alignment: size of a memory page and a common block size required by direct IO.
+constexpr size_type kDirectIoAlignment = 4096;
+
+
+namespace detail {
+
+template<typename MessageType, std::size_t...I>
+constexpr std::size_t variableFieldsCount(std::index_sequence<I...>) noexcept {
+	return (std::size_t{0} + ... + (FixedWireSize<FieldType<MessageType, I>>::value == 0 ? 1 : 0));
+}
+
+}  // namespace detail
+
+
+/**
+ * Check if a message ends with a data payload, that is only preceded by fixed size fields.
+ * Offset of the payload of such message is a compile time constant.
+ */
+template<typename MessageType>
+constexpr bool hasTrailingPayload() noexcept {
+	constexpr auto nFields = std::tuple_size<detail::SchemaFields<MessageType>>::value;
+	if constexpr (nFields == 0) {
+		return false;
+	} else {
+		return std::is_same<detail::FieldType<MessageType, nFields - 1>, Solace::MemoryView>::value &&
+				detail::variableFieldsCount<MessageType>(detail::FieldIndices<MessageType>{}) == 1;
+	}
+}
+
+
+/**
+ * Get offset of the data payload from the start of a message frame.
+ * @return Number of bytes of message header and fields, including payload size, preceding payload bytes.
+ */
+template<typename MessageType>
+constexpr size_type payloadOffset() noexcept {
+	static_assert(hasTrailingPayload<MessageType>(),
+				  "Message must end with a data payload preceded by fixed size fields only");
+
+	return headerSize() + fixedSizeOf<MessageType>() + sizeof(size_type);
+}
+
+
+/**
+ * Get offset of the data payload from the start of a message frame for a message type code.
+ * Used on the receiving side, when only a message header is known.
+ * @param messageType Message type code, @see MessageHeader::type.
+ * @return Offset of the payload or 0 if messages of this type do not carry a payload at a fixed offset.
+ */
+constexpr size_type payloadOffset(Solace::byte messageType) noexcept {
+	switch (messageType) {
+	case asByte(MessageType::RRead):					return payloadOffset<Response::Read>();
+	case asByte(MessageType::TWrite):					return payloadOffset<Request::Write>();
+	case asByte(_9P2000E::MessageType::RShortRead):		return payloadOffset<_9P2000E::Response::ShortRead>();
+	default:											return 0;
+	}
+}
+
+
+/**
+ * Round a size down to a multiple of the alignment.
+ * Direct IO also requires transfer sizes to be a multiple of the block size.
+ * @param size Size in bytes to round.
+ * @param alignment Required alignment. Must be a power of 2.
+ * @return Largest multiple of alignment not greater than size.
+ */
+constexpr size_type alignDown(size_type size, size_type alignment = kDirectIoAlignment) noexcept {
+	return size & ~(alignment - 1);
+}
+
+
+/**
+ * Get offset into a buffer to start a message frame at, for the payload of the message to be aligned.
+ * @param bufferStart Address of the buffer.
+ * @param payloadOffset Offset of the payload from the start of a message frame, @see payloadOffset.
+ * @param alignment Required payload alignment. Must be a power of 2.
+ * @return Offset of the frame into the buffer in bytes, less than alignment.
+ */
+size_type alignedFrameOffset(void const* bufferStart, size_type payloadOffset,
+							 size_type alignment = kDirectIoAlignment) noexcept;
+
+
+/**
+ * Get a part of a buffer to write a message frame into, for the payload of the message to be aligned.
+ * Padding is left out of the returned view, thus a writer over it only holds the frame.
+ * @param buffer Buffer to write a message into.
+ * @param payloadOffset Offset of the payload from the start of a message frame, @see payloadOffset.
+ * @param alignment Required payload alignment. Must be a power of 2.
+ * @return View of the buffer starting at the aligned frame position or an error if the buffer is too small.
+ */
+Result<Solace::MutableMemoryView> alignPayload(Solace::MutableMemoryView buffer, size_type payloadOffset,
+											   size_type alignment = kDirectIoAlignment);
+
+
+/**
+ * Get a part of a buffer to receive the rest of a message frame into, once its header has been received,
+ * for the payload of the message to be aligned. Messages without a payload at a fixed offset are not aligned.
+ * @param buffer Buffer to receive a message into.
+ * @param header Header of the message received.
+ * @param alignment Required payload alignment. Must be a power of 2.
+ * @return View of header.payloadSize() bytes of the buffer to receive the message body into,
+ * or an error if the buffer is too small.
+ */
+Result<Solace::MutableMemoryView> alignReceivedPayload(Solace::MutableMemoryView buffer, MessageHeader const& header,
+													   size_type alignment = kDirectIoAlignment);
+
+}  // end of namespace styxe
+#endif  // STYXE_PAYLOADALIGNMENT_HPP
@@ -0,0 +1,297 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_RESPONSEBATCH_HPP
+#define STYXE_RESPONSEBATCH_HPP
+
+#include "styxe/ioVecWriter.hpp"
+#include "styxe/errorDomain.hpp"
+
+#include <solace/byteWriter.hpp>
+#include <solace/result.hpp>
+
+#include <limits>
+#include <type_traits>
+#include <utility>  // std::declval
+
+
+namespace styxe {
+
+/// Trait to check if a response can be written by ResponseIoVecWriter, with its payload referenced, not copied.
+template<typename T, typename = void>
+struct IsIoVecEncodable : std::false_type {};
+
+template<typename T>
+struct IsIoVecEncodable<T, std::void_t<decltype(std::declval<ResponseIoVecWriter&>() << std::declval<T const&>())>> :
+		std::true_type {};
+
+
+/**
+ * Coalescing writer for a batch of responses.
+ *
+ * Responses to many requests, possibly of different tags, are appended back-to-back into a single output buffer.
+ * Data payload of read responses is not copied but referenced by an io vector, @see IoVecWriter.
+ * A batch is flushed to a sink - as a single list of io vectors - when either the number of bytes or the number of
+ * messages reaches a threshold, or when flushed explicitly. This way a burst of pipelined requests is answered
+ * with one `writev` call instead of one `write` per response.
+ *
+ * Sink is a callable invoked as `sink(iovec const* vecs, int count)` that returns Result<size_type> with the number
+ * of bytes sent, as `writev` does. If a sink sends only a part of a batch, the batch keeps messages not sent in full,
+ * so that the rest is sent by the next flush and a server can tell which responses went out, @see messagesSent.
+ *
+ * @note The batch does not allocate memory. Output buffer is provided by the user and must outlive the batch.
+ * Payload referenced by responses must remain valid until the batch is flushed.
+ *
+ * Example:
+ * @code
+ * ResponseBatch batch{buffer, 64*1024, 32};
+ * auto sink = [socket](iovec const* vecs, int count) -> Result<size_type> {
+ *     ... writev(socket, vecs, count) ...
+ * };
+ * for (...) {  // For each request received
+ *     batch.append(tag, Response::Read{data}, sink);
+ * }
+ * batch.flush(sink);
+ * @endcode
+ */
+struct ResponseBatch {
+
+	/// Maximum number of messages in a batch.
+	static constexpr size_type kMaxMessages = 64;
+
+	/// Maximum number of io vectors in a batch: each message adds at most header and payload vectors.
+	static constexpr int kMaxIoVecs = 2 * kMaxMessages;
+
+	/// Boundaries of a message in a batch.
+	struct MessageBoundary {
+		Tag			tag;		//!< Tag of the message.
+		size_type	offset;		//!< Offset in bytes of the message from the start of the batch.
+		size_type	size;		//!< Size of the message in bytes, including header and payload.
+	};
+
+	/**
+	 * Construct a new ResponseBatch.
+	 * @param buffer Output buffer to write messages into.
+	 * @param maxBytes Number of bytes in a batch, including payloads, that triggers a flush.
+	 * @param maxMessages Number of messages in a batch that triggers a flush. At most kMaxMessages.
+	 */
+	ResponseBatch(Solace::MutableMemoryView buffer,
+				  size_type maxBytes = std::numeric_limits<size_type>::max(),
+				  size_type maxMessages = kMaxMessages) noexcept;
+
+	ResponseBatch(ResponseBatch const&) = delete;
+	ResponseBatch& operator= (ResponseBatch const&) = delete;
+
+	/**
+	 * Get number of messages in the batch.
+	 * @return Number of messages appended since the last flush.
+	 */
+	constexpr size_type size() const noexcept { return _nMessages; }
+
+	/**
+	 * Check if the batch has no messages.
+	 * @return True if there is nothing to flush.
+	 */
+	constexpr bool empty() const noexcept { return _nMessages == 0; }
+
+	/**
+	 * Get number of bytes in the batch.
+	 * @return Total size of messages in the batch, including referenced payloads.
+	 */
+	constexpr size_type byteSize() const noexcept { return _nBytes; }
+
+	/**
+	 * Check if the batch reached either of the thresholds and must be flushed.
+	 * @return True if the batch is to be flushed.
+	 */
+	constexpr bool isFull() const noexcept { return _nMessages >= _maxMessages || _nBytes >= _maxBytes; }
+
+	/**
+	 * Get boundaries of a message in the batch.
+	 * Used to find out which messages have been sent if a sink only managed to write a part of a batch.
+	 * @param index Index of the message in the batch.
+	 * @return Boundaries of the message.
+	 */
+	MessageBoundary const& message(size_type index) const;
+
+	/**
+	 * Get number of bytes of the batch sent so far.
+	 * @return Number of bytes acknowledged as sent since the batch was last emptied.
+	 */
+	constexpr size_type bytesSent() const noexcept { return _nBytesSent; }
+
+	/**
+	 * Get number of messages sent in full.
+	 * Messages [0, messagesSent()) have been sent, the rest are still to be sent.
+	 * @return Number of messages that fit into bytesSent().
+	 */
+	size_type messagesSent() const noexcept;
+
+	/**
+	 * Get io vectors of the batch that are still to be sent.
+	 * @return Pointer to an array of ioVecCount() io vectors, suitable for `writev` and `sendmsg`.
+	 */
+	constexpr iovec const* ioVecs() const noexcept { return _ioVecs + _firstIoVec; }
+
+	/**
+	 * Get number of io vectors of the batch that are still to be sent.
+	 * Adjacent messages written into the output buffer share a single io vector.
+	 * @return Number of io vectors.
+	 */
+	constexpr int ioVecCount() const noexcept { return _nIoVecs - _firstIoVec; }
+
+	/**
+	 * Acknowledge bytes of the batch sent, for example by a `writev` call that sent only a part of the batch.
+	 * Io vectors are advanced past the bytes sent. The batch is emptied once all of it has been sent.
+	 * @param nBytes Number of bytes sent.
+	 */
+	void acknowledge(size_type nBytes) noexcept;
+
+	/**
+	 * Append a response to the batch.
+	 * The batch is flushed before the response is appended if the response does not fit into the output buffer,
+	 * and after it has been appended if a threshold is reached.
+	 *
+	 * @param tag Tag of the request this response is for.
+	 * @param message A response message to append.
+	 * @param sink A sink to flush the batch to.
+	 * @return Void or an error if the message does not fit into an empty buffer, if the sink failed, or if the sink
+	 * has not sent enough of the batch to make space for the message.
+	 */
+	template<typename Message, typename Sink>
+	Result<void> append(Tag tag, Message const& message, Sink&& sink) {
+		if (!tryAppend(tag, message)) {
+			if (empty()) {
+				return getCannedError(CannedError::NotEnoughSpace);
+			}
+
+			auto flushed = flush(sink);
+			if (!flushed) {
+				return flushed;
+			}
+
+			if (!tryAppend(tag, message)) {
+				return getCannedError(CannedError::NotEnoughSpace);
+			}
+		}
+
+		if (isFull()) {
+			return flush(sink);
+		}
+
+		return Solace::Ok();
+	}
+
+	/**
+	 * Flush the batch to a sink.
+	 * The batch is empty afterwards if the sink sent all of it. If the sink sent only a part of the batch,
+	 * messages not sent in full are kept, @see messagesSent. If the sink failed, the batch is not changed.
+	 * @param sink A sink to flush the batch to.
+	 * @return Void or an error of the sink.
+	 */
+	template<typename Sink>
+	Result<void> flush(Sink&& sink) {
+		if (empty()) {
+			return Solace::Ok();
+		}
+
+		Result<size_type> sent = sink(ioVecs(), ioVecCount());
+		if (!sent) {
+			return sent.moveError();
+		}
+
+		acknowledge(*sent);
+
+		return Solace::Ok();
+	}
+
+	/**
+	 * Discard all messages in the batch.
+	 */
+	void clear() noexcept;
+
+private:
+
+	/**
+	 * Write a response into the output buffer.
+	 * @return True if the response was written, false if it does not fit into the batch.
+	 */
+	template<typename Message>
+	bool tryAppend(Tag tag, Message const& message) {
+		if (_nMessages >= kMaxMessages) {
+			return false;
+		}
+
+		auto const startPos = _buffer.position();
+		if constexpr (IsIoVecEncodable<Message>::value) {
+			ResponseIoVecWriter writer{_buffer, tag};
+			writer << message;
+
+			return commit(startPos, writer.header(), writer.payload());
+		} else {
+			if (messageSize(message) > _buffer.remaining()) {
+				return false;
+			}
+
+			ResponseWriter writer{_buffer, tag};
+			writer << message;
+
+			return commit(startPos, writer.header(), Solace::MemoryView{});
+		}
+	}
+
+	/**
+	 * Record a message written into the output buffer.
+	 * @return True if the message has been written in full, false if it has been discarded.
+	 */
+	bool commit(Solace::ByteWriter::size_type startPos, MessageHeader header, Solace::MemoryView payload);
+
+	/// Append an io vector, merging it with the last one if the memory is adjacent.
+	void addIoVec(Solace::MemoryView data) noexcept;
+
+	/// Output buffer messages are written into.
+	Solace::ByteWriter		_buffer;
+
+	/// Number of bytes in a batch that triggers a flush.
+	size_type const			_maxBytes;
+
+	/// Number of messages in a batch that triggers a flush.
+	size_type const			_maxMessages;
+
+	/// Number of bytes in the batch.
+	size_type				_nBytes{0};
+
+	/// Number of messages in the batch.
+	size_type				_nMessages{0};
+
+	/// Number of bytes of the batch sent.
+	size_type				_nBytesSent{0};
+
+	/// Number of io vectors in use.
+	int						_nIoVecs{0};
+
+	/// Index of the first io vector not sent in full.
+	int						_firstIoVec{0};
+
+	/// Boundaries of messages in the batch.
+	MessageBoundary			_messages[kMaxMessages]{};
+
+	/// Io vectors of the batch.
+	iovec					_ioVecs[kMaxIoVecs]{};
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_RESPONSEBATCH_HPP
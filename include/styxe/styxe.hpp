@@ -27,6 +27,17 @@
 #include "9p2000L.hpp"
 
 #include "messageWriter.hpp"
+#include "ioVecWriter.hpp"
+#include "responseBatch.hpp"
+#include "payloadAlignment.hpp"
+#include "fixedFrame.hpp"
+#include "messageBufferPool.hpp"
+#include "arena.hpp"
+#include "tagAllocator.hpp"
 #include "messageParser.hpp"
+#include "dialectParser.hpp"
+#include "frameAssembler.hpp"
+#include "messageView.hpp"
+#include "messageSchema.hpp"
 
 #endif  // STYXE_STYXE_HPP
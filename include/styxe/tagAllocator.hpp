@@ -0,0 +1,256 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_TAGALLOCATOR_HPP
+#define STYXE_TAGALLOCATOR_HPP
+
+#include "styxe/9p2000.hpp"
+#include "styxe/9p2000L.hpp"
+#include "styxe/errorDomain.hpp"
+
+#include <solace/utils.hpp>  // mv<>
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+
+namespace styxe {
+
+/**
+ * Allocator of tags for requests of a client.
+ *
+ * Each request in flight must have a tag unique among requests in flight, @see MessageHeader::tag.
+ * Free tags are kept on a lock-free list, so that a tag is acquired and released in O(1) time from any thread.
+ * kNoTag is reserved for version messages and is never allocated.
+ *
+ * Example:
+ * @code
+ * TagAllocator tags{maxRequestsInFlight};
+ * auto tag = tags.acquire();  // An error if there are too many requests in flight.
+ * RequestWriter writer{dest, *tag};
+ * writer << Request::Clunk{fid};
+ * ...
+ * tags.release(header.tag);  // Once the response is received.
+ * @endcode
+ */
+struct TagAllocator {
+
+	/// Maximum number of tags: all values of the Tag type except kNoTag.
+	static constexpr size_type kMaxTags = std::numeric_limits<Tag>::max();
+
+	/**
+	 * Construct a new allocator.
+	 * @param capacity Number of tags to allocate, that is the maximum number of requests in flight.
+	 * Tags are allocated from the range [0, capacity). At most kMaxTags.
+	 */
+	explicit TagAllocator(size_type capacity = kMaxTags);
+
+	TagAllocator(TagAllocator const&) = delete;
+	TagAllocator& operator= (TagAllocator const&) = delete;
+
+	/**
+	 * Get number of tags the allocator manages.
+	 * @return Maximum number of tags acquired at once.
+	 */
+	size_type capacity() const noexcept { return static_cast<size_type>(_next.size()); }
+
+	/**
+	 * Get number of tags acquired and not yet released.
+	 * Clients use it to apply backpressure, before all tags are exhausted.
+	 * @return Number of requests in flight.
+	 */
+	size_type inFlight() const noexcept { return _inFlight.load(std::memory_order_relaxed); }
+
+	/**
+	 * Acquire a free tag.
+	 * @return A tag or an error if all tags are in use.
+	 */
+	Result<Tag> acquire();
+
+	/**
+	 * Release a tag so that it can be reused.
+	 * @param tag A tag previously acquired from this allocator.
+	 */
+	void release(Tag tag);
+
+private:
+
+	/// Next free tag for each free tag.
+	std::vector<std::atomic<Tag>>	_next;
+
+	/// First free tag in the low 32 bits and, in the high bits, a counter of list updates against ABA.
+	std::atomic<Solace::uint64>		_head;
+
+	/// Number of tags in use.
+	std::atomic<size_type>			_inFlight{0};
+};
+
+
+/**
+ * Get type code of a response expected for a request.
+ * In 9P a response message type code always follows the code of its request.
+ */
+template<typename RequestType>
+constexpr Solace::byte expectedResponseCodeOf() noexcept {
+	return messageCodeOf<RequestType>() + 1;
+}
+
+
+/**
+ * Table of client requests in flight.
+ *
+ * Allocates a tag for each request sent and records the response type expected and a completion - any value
+ * a client uses to deliver the response to its waiter, such as a promise or a pointer to a callback.
+ * A response header, as returned by parseMessageHeader, is routed to the completion of its request in O(1).
+ *
+ * Requests can be added from any thread. Responses are expected to be completed by a single thread reading them.
+ *
+ * Example:
+ * @code
+ * PendingRequests<Waiter*> pending{64};
+ * auto tag = pending.add<Request::Read>(&waiter);
+ * ...
+ * auto header = parseMessageHeader(reader);
+ * auto waiter = pending.complete(*header);  // Waiter of the request or an error if the tag or type is unexpected.
+ * auto response = parser.parseResponse(*header, reader);
+ * @endcode
+ *
+ * @tparam Completion Type of a completion slot. Must be default constructible and movable.
+ */
+template<typename Completion>
+struct PendingRequests {
+
+	/**
+	 * Construct a new table.
+	 * @param capacity Maximum number of requests in flight. At most TagAllocator::kMaxTags.
+	 */
+	explicit PendingRequests(size_type capacity = TagAllocator::kMaxTags)
+		: _tags{capacity}
+		, _entries(_tags.capacity())
+	{}
+
+	PendingRequests(PendingRequests const&) = delete;
+	PendingRequests& operator= (PendingRequests const&) = delete;
+
+	/**
+	 * Get maximum number of requests in flight.
+	 * @return Capacity of the table.
+	 */
+	size_type capacity() const noexcept { return _tags.capacity(); }
+
+	/**
+	 * Get number of requests in flight.
+	 * @return Number of requests added and not yet completed.
+	 */
+	size_type inFlight() const noexcept { return _tags.inFlight(); }
+
+	/**
+	 * Add a request of a given type.
+	 * @param completion A completion slot of the request.
+	 * @return Tag to send the request with or an error if there are too many requests in flight.
+	 */
+	template<typename RequestType>
+	Result<Tag> add(Completion completion) {
+		return add(expectedResponseCodeOf<RequestType>(), Solace::mv(completion));
+	}
+
+	/**
+	 * Add a request expecting a response of a given type.
+	 * @param responseType Type code of the response expected.
+	 * @param completion A completion slot of the request.
+	 * @return Tag to send the request with or an error if there are too many requests in flight.
+	 */
+	Result<Tag> add(Solace::byte responseType, Completion completion) {
+		auto maybeTag = _tags.acquire();
+		if (maybeTag) {
+			auto& entry = _entries[*maybeTag];
+			entry.completion = Solace::mv(completion);
+			entry.responseType.store(responseType, std::memory_order_release);
+		}
+
+		return maybeTag;
+	}
+
+	/**
+	 * Complete a request given a header of the response received.
+	 * An error response, RError or Rlerror, completes a request of any type.
+	 * The tag of the request is released and can be reused.
+	 *
+	 * @param header Header of the response received.
+	 * @return Completion slot of the request or an error if no request is in flight with the tag of the response,
+	 * or the response is of an unexpected type. Table is not changed in case of an error.
+	 */
+	Result<Completion> complete(MessageHeader const& header) {
+		auto const responseType = expectedResponseType(header.tag);
+		if (responseType == 0) {
+			return getCannedError(CannedError::UnexpectedTag);
+		}
+
+		if (header.type != responseType &&
+			header.type != asByte(MessageType::RError) &&
+			header.type != asByte(_9P2000L::MessageType::Rlerror)) {
+			return getCannedError(CannedError::UnexpectedResponseType);
+		}
+
+		return remove(header.tag);
+	}
+
+	/**
+	 * Remove a request without checking the response type.
+	 * Used when a request is flushed or a connection is aborted.
+	 * @param tag Tag of the request.
+	 * @return Completion slot of the request or an error if no request is in flight with the tag.
+	 */
+	Result<Completion> remove(Tag tag) {
+		if (expectedResponseType(tag) == 0) {
+			return getCannedError(CannedError::UnexpectedTag);
+		}
+
+		auto& entry = _entries[tag];
+		Result<Completion> result{Solace::types::okTag, Solace::in_place, Solace::mv(entry.completion)};
+		entry.completion = Completion{};
+		entry.responseType.store(0, std::memory_order_relaxed);
+		_tags.release(tag);
+
+		return result;
+	}
+
+	/**
+	 * Get type code of the response expected for a request in flight.
+	 * @param tag Tag of the request.
+	 * @return Response type code or 0 if no request is in flight with the tag.
+	 */
+	Solace::byte expectedResponseType(Tag tag) const noexcept {
+		return (tag < _entries.size())
+				? _entries[tag].responseType.load(std::memory_order_acquire)
+				: 0;
+	}
+
+private:
+
+	/// A request in flight.
+	struct Entry {
+		std::atomic<Solace::byte>	responseType{0};	//!< Type code of the response expected, 0 if slot is free.
+		Completion					completion{};		//!< Completion slot of the request.
+	};
+
+	TagAllocator			_tags;
+	std::vector<Entry>		_entries;
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_TAGALLOCATOR_HPP
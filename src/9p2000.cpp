@@ -52,66 +52,80 @@ styxe::getVersion() noexcept {
 }
 
 
-styxe::Result<ByteReader&>
-styxe::operator>> (ByteReader& data, Response::Walk& dest) {
-	Decoder decoder{data};
+Qid
+QidSpan::operator[] (size_type index) const {
+	assertIndexInRange(index, size_type{0}, _size, "QidSpan[]");
 
-	// FIXME: Response::Walk can't hold more then 16 qids!
-	auto result = decoder >> dest.nqids;
-	for (decltype(dest.nqids) i = 0; i < dest.nqids && result; ++i) {
-		result = decoder >> dest.qids[i];
-	}
+	Qid result{};
+	ByteReader reader{_data.slice(index * kQidSize, (index + 1) * kQidSize)};
+	Decoder decoder{reader};
+	decoder >> result;
+
+	return result;
+}
 
+
+styxe::Result<ByteReader&>
+styxe::operator>> (ByteReader& data, Response::Walk& dest) {
+	QidSpan::size_type nQids = 0;
+	auto result = data.readLE(nQids);
 	if (!result)
 		return result.moveError();
 
+	auto const qidsSize = nQids * QidSpan::kQidSize;
+	if (data.remaining() < qidsSize)
+		return getCannedError(CannedError::NotEnoughData);
+
+	dest.qids = QidSpan{nQids, data.viewRemaining().slice(0, qidsSize)};
+	data.position(data.position() + qidsSize);
+
 	return styxe::Result<ByteReader&>{types::okTag, data};
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Version& dest) {
-	return decode(data, dest.msize, dest.version);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Auth& dest) {
-	return decode(data, dest.qid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Attach& dest) {
-	return decode(data, dest.qid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Error& dest) {
-	return decode(data, dest.ename);
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Open& dest) {
-	return decode(data, dest.qid, dest.iounit);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Create& dest) {
-	return decode(data, dest.qid, dest.iounit);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Read& dest) {
-	return decode(data, dest.data);
+	return decodeMessage(data, dest);
 }
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Write& dest) {
-	return decode(data, dest.count);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Response::Stat& dest) {
-	return decode(data, dest.dummySize, dest.data);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -132,67 +146,67 @@ styxe::operator>> (ByteReader& data, Response::WStat& ) { return styxe::Result<B
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Version& dest) {
-	return decode(data, dest.msize, dest.version);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Auth& dest) {
-	return decode(data, dest.afid, dest.uname, dest.aname);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Attach& dest) {
-	return decode(data, dest.fid, dest.afid, dest.uname, dest.aname);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Flush& dest) {
-	return decode(data, dest.oldtag);
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Walk& dest) {
-	return decode(data, dest.fid, dest.newfid, dest.path);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Open& dest) {
-	return decode(data, dest.fid, dest.mode.mode);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Create& dest) {
-	return decode(data, dest.fid, dest.name, dest.perm, dest.mode.mode);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Read& dest) {
-	return decode(data, dest.fid, dest.offset, dest.count);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Write& dest) {
-	return decode(data, dest.fid, dest.offset, dest.data);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Clunk& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Remove& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::Stat& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, Request::WStat& dest) {
-	return decode(data, dest.fid, dest.stat);
+	return decodeMessage(data, dest);
 }
 
 
@@ -82,354 +82,277 @@ styxe::_9P2000L::messageTypeToString(byte type) noexcept {
 
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::StatFS const& message){
-	return encode(writer, message, message.fid);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::LOpen const& message) {
-	return encode(writer, message, message.fid, message.flags);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::LCreate const& message) {
-	return encode(writer, message,
-				  message.fid,
-				  message.name,
-				  message.flags,
-				  message.mode,
-				  message.gid);
+	return encodeMessage(writer, message);
 
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::Symlink const& message) {
-	return encode(writer, message,
-				  message.fid,
-				  message.name,
-				  message.symtgt,
-				  message.gid);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::MkNode const& message){
-	return encode(writer, message,
-			message.dfid,
-			message.name,
-			message.mode,
-			message.major,
-			message.minor,
-			message.gid);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::Rename const& message){
-	return encode(writer, message,
-			message.fid,
-			message.dfid,
-			message.name);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::ReadLink const& message){
-	return encode(writer, message,
-			message.fid);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::GetAttr const& message){
-	return encode(writer, message,
-			message.fid,
-			message.request_mask);
+	return encodeMessage(writer, message);
 
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::SetAttr const& message){
-	return encode(writer, message,
-			message.fid,
-			message.valid,
-			message.mode,
-			message.uid,
-			message.gid,
-			message.size,
-			message.atime_sec, message.atime_nsec,
-			message.mtime_sec, message.mtime_nsec);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::XAttrWalk const& message){
-	return encode(writer, message,
-			message.fid,
-			message.newfid,
-			message.name);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::XAttrCreate const& message){
-	return encode(writer, message,
-			message.fid,
-			message.name,
-			message.attr_size,
-			message.flags);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::ReadDir const& message){
-	return encode(writer, message,
-			message.fid,
-			message.offset,
-			message.count);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::FSync const& message){
-	return encode(writer, message,
-			message.fid);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::Lock const& message){
-	return encode(writer, message,
-			message.fid,
-			message.type,
-			message.flags,
-			message.start,
-			message.length,
-			message.proc_id,
-			message.client_id);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::GetLock const& message) {
-	return encode(writer, message,
-			message.fid,
-			message.type,
-			message.start,
-			message.length,
-			message.proc_id,
-			message.client_id);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::Link const& message) {
-	return encode(writer, message,
-			message.dfid,
-			message.fid,
-			message.name);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::MkDir const& message) {
-	return encode(writer, message,
-			message.dfid,
-			message.name,
-			message.mode,
-			message.gid);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::RenameAt const& message){
-	return encode(writer, message, message.olddirfid, message.oldname, message.newdirfid, message.newname);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter& styxe::operator<< (RequestWriter& writer, _9P2000L::Request::UnlinkAt const& message) {
-	return encode(writer, message, message.dfid, message.name, message.flags);
+	return encodeMessage(writer, message);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::LError const& message){
-	return encode(writer, message, message.ecode);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::StatFS const& message) {
-	return encode(writer, message,
-				  message.type,
-				  message.bsize,
-				  message.blocks,
-				  message.bfree,
-				  message.bavail,
-				  message.files,
-				  message.ffree,
-				  message.fsid,
-				  message.namelen);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::LOpen const& message){
-	return encode(writer, message, message.qid, message.iounit);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::LCreate const& message){
-	return encode(writer, message, message.qid, message.iounit);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Symlink const& message){
-	return encode(writer, message, message.qid);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::MkNode const& message){
-	return encode(writer, message, message.qid);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Rename const&  message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::ReadLink const& message){
-	return encode(writer, message, message.target);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::GetAttr const& m){
-	return encode(writer, m,
-				  m.valid,
-				  m.qid,
-				  m.mode,
-				  m.uid,
-				  m.gid,
-				  m.nlink,
-				  m.rdev,
-				  m.size,
-				  m.blksize,
-				  m.blocks,
-				  m.atime_sec, m.atime_nsec,
-				  m.mtime_sec, m.mtime_nsec,
-				  m.ctime_sec, m.ctime_nsec,
-				  m.btime_sec, m.btime_nsec,
-				  m.gen, m.data_version);
+	return encodeMessage(writer, m);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::SetAttr const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::XAttrWalk const& message) {
-	return encode(writer, message, message.size);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::XAttrCreate const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::ReadDir const& message) {
-	return encode(writer, message, message.data);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::FSync const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Lock const& message) {
-	return encode(writer, message, message.status);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::GetLock const& message) {
-	return encode(writer, message, message.type, message.start, message.length, message.proc_id, message.client_id);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Link const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::MkDir const& message) {
-	return encode(writer, message, message.qid);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::RenameAt const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter& styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::UnlinkAt const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
+}
+
+PartialDataWriter
+styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Partial::ReadDir const&) {
+	writer.messageTypeOf<_9P2000L::Response::ReadDir>();
+
+	return PartialDataWriter{writer};
+}
+
+PartialStringWriter
+styxe::operator<< (ResponseWriter& writer, _9P2000L::Response::Partial::ReadLink const&) {
+	writer.messageTypeOf<_9P2000L::Response::ReadLink>();
+
+	return PartialStringWriter{writer};
 }
 
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::StatFS& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::LOpen& dest) {
-	return decode(data, dest.fid, dest.flags);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::LCreate& dest) {
-	return decode(data, dest.fid, dest.name, dest.flags, dest.mode, dest.gid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::Symlink& dest) {
-	return decode(data, dest.fid, dest.name, dest.symtgt, dest.gid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::MkNode& dest) {
-	return decode(data, dest.dfid, dest.name, dest.mode, dest.major, dest.minor, dest.gid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::Rename& dest) {
-	return decode(data, dest.fid, dest.dfid, dest.name);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::ReadLink& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::GetAttr& dest) {
-	return decode(data, dest.fid, dest.request_mask);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::SetAttr& dest) {
-	return decode(data, dest.fid,
-				  dest.valid,
-				  dest.mode,
-				  dest.uid,
-				  dest.gid,
-				  dest.size,
-				  dest.atime_sec, dest.atime_nsec,
-				  dest.mtime_sec, dest.mtime_nsec);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::XAttrWalk& dest) {
-	return decode(data, dest.fid, dest.newfid, dest.name);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::XAttrCreate& dest) {
-	return decode(data, dest.fid, dest.name, dest.attr_size, dest.flags);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::ReadDir& dest) {
-	return decode(data, dest.fid, dest.offset, dest.count);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::FSync& dest) {
-	return decode(data, dest.fid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::Lock& dest) {
-	return decode(data, dest.fid, dest.type, dest.flags, dest.start, dest.length, dest.proc_id, dest.client_id);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::GetLock& dest) {
-	return decode(data, dest.fid, dest.type, dest.start, dest.length, dest.proc_id, dest.client_id);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::Link& dest) {
-	return decode(data, dest.dfid, dest.fid, dest.name);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::MkDir& dest) {
-	return decode(data, dest.dfid, dest.name, dest.mode, dest.gid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::RenameAt& dest) {
-	return decode(data, dest.olddirfid, dest.oldname, dest.newdirfid, dest.newname);
+	return decodeMessage(data, dest);
 }
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Request::UnlinkAt& dest) {
-	return decode(data, dest.dfid, dest.name, dest.flags);
+	return decodeMessage(data, dest);
 }
 
 
@@ -437,41 +360,32 @@ styxe::operator>> (ByteReader& data, _9P2000L::Request::UnlinkAt& dest) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::LError& dest) {
-	return decode(data, dest.ecode);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::StatFS& dest) {
-	return decode(data,
-				  dest.type,
-				  dest.bsize,
-				  dest.blocks,
-				  dest.bfree,
-				  dest.bavail,
-				  dest.files,
-				  dest.ffree,
-				  dest.fsid,
-				  dest.namelen);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::LOpen& dest) {
-	return decode(data, dest.qid, dest.iounit);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::LCreate& dest) {
-	return decode(data, dest.qid, dest.iounit);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::Symlink& dest) {
-	return decode(data, dest.qid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::MkNode& dest) {
-	return decode(data, dest.qid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -481,27 +395,12 @@ styxe::operator>> (ByteReader& data, _9P2000L::Response::Rename&) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::ReadLink& dest) {
-	return decode(data, dest.target);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::GetAttr& dest) {
-	return decode(data,
-				  dest.valid,
-				  dest.qid,
-				  dest.mode,
-				  dest.uid,
-				  dest.gid,
-				  dest.nlink,
-				  dest.rdev,
-				  dest.size,
-				  dest.blksize,
-				  dest.blocks,
-				  dest.atime_sec, dest.atime_nsec,
-				  dest.mtime_sec, dest.mtime_nsec,
-				  dest.ctime_sec, dest.ctime_nsec,
-				  dest.btime_sec, dest.btime_nsec,
-				  dest.gen, dest.data_version);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -511,7 +410,7 @@ styxe::operator>> (ByteReader& data, _9P2000L::Response::SetAttr&) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::XAttrWalk& dest) {
-	return decode(data, dest.size);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -521,7 +420,7 @@ styxe::operator>> (ByteReader& data, _9P2000L::Response::XAttrCreate&) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::ReadDir& dest) {
-	return decode(data, dest.data);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -531,12 +430,12 @@ styxe::operator>> (ByteReader& data, _9P2000L::Response::FSync&) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::Lock& dest) {
-	return decode(data, dest.status);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::GetLock& dest) {
-	return decode(data, dest.type, dest.start, dest.length, dest.proc_id, dest.client_id);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -546,7 +445,7 @@ styxe::operator>> (ByteReader& data, _9P2000L::Response::Link&) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000L::Response::MkDir& dest) {
-	return decode(data, dest.qid);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
@@ -571,3 +470,54 @@ _9P2000L::DirEntryReader::Iterator::read() {
 
 	return Ok();
 }
+
+
+size_type
+styxe::protocolSize(_9P2000L::DirEntry const& value) noexcept {
+	return protocolSize(value.qid) +
+			protocolSize(value.offset) +
+			protocolSize(value.type) +
+			protocolSize(value.name);
+}
+
+
+_9P2000L::ReadDirWriter::ReadDirWriter(ResponseWriter& writer, uint32 count, uint64 offset) noexcept
+	: _writer{writer}
+	, _dataPosition{0}
+	, _count{count}
+	, _nextOffset{offset}
+{
+	auto& encoder = _writer.messageTypeOf<Response::ReadDir>();
+	_dataPosition = encoder.buffer().position();
+	encoder << size_type{0};  // Data size placeholder, written once by finish()
+}
+
+
+bool
+_9P2000L::ReadDirWriter::encode(DirEntry const& entry) {
+	auto const entrySize = protocolSize(entry);
+	if (_bytesEncoded + entrySize > _count) {
+		return false;
+	}
+
+	auto& encoder = _writer.encoder();
+	if (encoder.buffer().remaining() < entrySize) {
+		return false;
+	}
+
+	encoder << entry;
+	_bytesEncoded += entrySize;
+	_nEntries += 1;
+	_nextOffset = entry.offset;
+
+	return true;
+}
+
+
+ResponseWriter&
+_9P2000L::ReadDirWriter::finish() {
+	patchCounter(_writer.encoder(), _dataPosition, _bytesEncoded);
+	_writer.finish();
+
+	return _writer;
+}
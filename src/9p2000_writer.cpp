@@ -26,166 +26,162 @@ using namespace styxe;
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Version const& message) {
-	return encode(writer, message, message.msize, message.version);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Auth const& message) {
-	return encode(writer, message, message.qid);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Error const& message) {
-	return encode(writer, message, message.ename);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Flush const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Attach const& message) {
-	return encode(writer, message, message.qid);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Walk const& response) {
-	auto& e = writer.messageTypeOf<std::decay_t<decltype(response)>>();
-	e << response.nqids;
-
-	for (decltype(response.nqids) i = 0; i < response.nqids; ++i) {
-			e << response.qids[i];
-	}
-	writer.updateMessageSize();
+	auto& e = writer.messageTypeOf<Response::Walk>(protocolSize(response));
+	e << response.qids.size();
+	e.buffer().write(response.qids.data());
 
 	return writer;
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Open const& message) {
-	return encode(writer, message, message.qid, message.iounit);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Create const& message) {
-	return encode(writer, message, message.qid, message.iounit);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Read const& message) {
-	return encode(writer, message, message.data);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Write const& message) {
-	return encode(writer, message, message.count);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Clunk const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Remove const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::Stat const& message) {
-	return encode(writer, message, message.dummySize, message.data);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, Response::WStat const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Version const& message) {
-	return encode(writer, message, message.msize, message.version);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Auth const& message) {
-	return encode(writer, message, message.afid, message.uname, message.aname);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Flush const& message) {
-	return encode(writer, message, message.oldtag);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Attach const& message) {
-	return encode(writer, message, message.fid, message.afid, message.uname, message.aname);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Walk const& message) {
-	return encode(writer, message, message.fid, message.newfid, message.path);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Open const& message) {
-	return encode(writer, message, message.fid, message.mode.mode);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Create const& message) {
-	return encode(writer, message, message.fid, message.name, message.perm, message.mode.mode);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Read const& message) {
-	return encode(writer, message, message.fid, message.offset, message.count);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Write const& message) {
-	return encode(writer, message, message.fid, message.offset, message.data);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Clunk const& message) {
-	return encode(writer, message, message.fid);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Remove const& message) {
-	return encode(writer, message, message.fid);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::Stat const& message) {
-	return encode(writer, message, message.fid);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, Request::WStat const& message) {
-	return encode(writer, message, message.fid, message.stat);
+	return encodeMessage(writer, message);
 }
 
 
@@ -230,6 +226,14 @@ styxe::operator<< (ResponseWriter& writer, Response::Partial::Error const&) {
 }
 
 
+PartialQidWriter
+styxe::operator<< (ResponseWriter& writer, Response::Partial::Walk const&) {
+	writer.messageTypeOf<Response::Walk>();
+
+	return PartialQidWriter{writer};
+}
+
+
 
 size_type
 styxe::protocolSize(Qid const&) noexcept {
@@ -259,6 +263,25 @@ styxe::protocolSize(styxe::Stat const& stat) noexcept {
 }
 
 
+size_type
+styxe::protocolSize(Response::Walk const& message) noexcept {
+	return sizeof(QidSpan::size_type) + narrow_cast<size_type>(message.qids.data().size());
+}
+
+
+
+
+bool
+DirListingCursor::seek(Solace::uint64 offset, Solace::uint32 dirVersion) noexcept {
+	if (_offset == offset && _version == dirVersion) {
+		return true;
+	}
+
+	*this = DirListingCursor{};
+	_version = dirVersion;
+
+	return (offset == 0);
+}
 
 
 DirListingWriter::DirListingWriter(ResponseWriter& writer, Solace::uint32 maxBytes, Solace::uint64 offset) noexcept
@@ -273,6 +296,15 @@ DirListingWriter::DirListingWriter(ResponseWriter& writer, Solace::uint32 maxByt
 }
 
 
+DirListingWriter::DirListingWriter(ResponseWriter& writer, Solace::uint32 maxBytes, Solace::uint64 offset,
+								   DirListingCursor& cursor) noexcept
+		: DirListingWriter{writer, maxBytes, offset}
+{
+	_bytesTraversed = cursor.offset();  // Entries before the cursor are not fed again
+	_cursor = &cursor;
+}
+
+
 void DirListingWriter::updateDataSize() {
 	auto& buffer = _writer.encoder().buffer();
 
@@ -285,23 +317,31 @@ void DirListingWriter::updateDataSize() {
 }
 
 
-bool DirListingWriter::encode(Stat const& stat) {
+bool DirListingWriter::encode(Stat const& stat, Solace::uint64 nextCookie) {
 	auto const protoSize = ::protocolSize(stat);
-    // Keep count of how many data we have traversed.
-    _bytesTraversed += protoSize;
-	if (_bytesTraversed <= _offset) {  // Client is only interested in data pass the offset.
-        return true;
-    }
-
-    // Keep track of much data will end up in a buffer to prevent overflow.
-    _bytesEncoded += protoSize;
-	if (_bytesEncoded > _maxBytes) {
-        return false;
-    }
-
-    // Only encode the data if we have some room left, as specified by 'count' arg.
-	_writer.encoder() << stat;
+	if (_bytesTraversed + protoSize <= _offset) {  // Client is only interested in data pass the offset.
+		_bytesTraversed += protoSize;
+		if (_cursor) {
+			_cursor->advance(protoSize, nextCookie);
+		}
+
+		return true;
+	}
+
+	// Keep track of much data will end up in a buffer to prevent overflow.
+	if (_bytesEncoded + protoSize > _maxBytes) {
+		return false;
+	}
 
+	// Only encode the data if we have some room left, as specified by 'count' arg.
+	_bytesTraversed += protoSize;
+	_bytesEncoded += protoSize;
+	_writer.encoder() << stat;
 	updateDataSize();
-    return true;
+
+	if (_cursor) {
+		_cursor->advance(protoSize, nextCookie);
+	}
+
+	return true;
 }
@@ -29,26 +29,18 @@ const StringLiteral _9P2000E::kProtocolVersion{"9P2000.e"};
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000E::Request::Session& dest) {
-	return decode(data,
-				dest.key[0],
-				dest.key[1],
-				dest.key[2],
-				dest.key[3],
-				dest.key[4],
-				dest.key[5],
-				dest.key[6],
-				dest.key[7]);
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000E::Request::ShortRead& dest) {
-	return decode(data, dest.fid, dest.path);
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000E::Request::ShortWrite& dest) {
-	return decode(data, dest.fid, dest.path, dest.data);
+	return decodeMessage(data, dest);
 }
 
 
@@ -60,55 +52,54 @@ styxe::operator>> (ByteReader& data, _9P2000E::Response::Session& ) {
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000E::Response::ShortRead& dest) {
-	return decode(data, dest.data);
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000E::Response::ShortWrite& dest) {
-	return decode(data, dest.count);
+	return decodeMessage(data, dest);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, _9P2000E::Response::Session const& message) {
-	return encode(writer, message);
+	return encodeMessage(writer, message);
 }
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, _9P2000E::Response::ShortRead const& message) {
-	return encode(writer, message, message.data);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, _9P2000E::Response::ShortWrite const& message) {
-	return encode(writer, message, message.count);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000E::Request::Session const& message) {
-	return encode(writer,
-				  message,
-				  message.key[0],
-				  message.key[1],
-				  message.key[2],
-				  message.key[3],
-				  message.key[4],
-				  message.key[5],
-				  message.key[6],
-				  message.key[7]);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000E::Request::ShortRead const& message) {
-	return encode(writer, message, message.fid, message.path);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000E::Request::ShortWrite const& message) {
-	return encode(writer, message, message.fid, message.path, message.data);
+	return encodeMessage(writer, message);
+}
+
+
+PartialDataWriter
+styxe::operator<< (ResponseWriter& writer, _9P2000E::Response::Partial::ShortRead const&) {
+	writer.messageTypeOf<_9P2000E::Response::ShortRead>();
+
+	return PartialDataWriter{writer};
 }
 
 
@@ -29,90 +29,68 @@ const uint32		_9P2000U::kNonUid{static_cast<uint32>(~0)};
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000U::Request::Auth const& message) {
-	return encode(writer, message, message.afid, message.uname, message.aname, message.n_uname);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000U::Request::Attach const& message) {
-	return encode(writer, message,
-				  message.fid,
-				  message.afid,
-				  message.uname,
-				  message.aname,
-				  message.n_uname);
+	return encodeMessage(writer, message);
 }
 
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000U::Request::Create const& message) {
-	return encode(writer, message,
-				  message.fid,
-				  message.name,
-				  message.perm,
-				  message.mode.mode,
-				  message.extension);
+	return encodeMessage(writer, message);
 }
 
 RequestWriter&
 styxe::operator<< (RequestWriter& writer, _9P2000U::Request::WStat const& message) {
-	return encode(writer, message, message.fid, message.stat);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, _9P2000U::Response::Error const& message) {
-	return encode(writer, message, message.ename, message.errcode);
+	return encodeMessage(writer, message);
 }
 
 
 ResponseWriter&
 styxe::operator<< (ResponseWriter& writer, _9P2000U::Response::Stat const& message) {
-	return encode(writer, message, message.dummySize, message.data);
+	return encodeMessage(writer, message);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Request::Auth& dest) {
-	return (data >> static_cast<Request::Auth&>(dest))
-			.then([&](ByteReader& reader) {
-				return decode(reader, dest.n_uname);
-			});
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Request::Attach& dest) {
-	return (data >> static_cast<Request::Attach&>(dest))
-			.then([&](ByteReader& reader) {
-				return decode(reader, dest.n_uname);
-			});
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Request::Create& dest) {
-	return (data >> static_cast<Request::Create&>(dest))
-			.then([&](ByteReader& reader) {
-				return decode(reader, dest.extension);
-			});
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Request::WStat& dest) {
-	return decode(data, dest.fid, dest.stat);
+	return decodeMessage(data, dest);
 }
 
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Response::Error& dest) {
-	return (data >> static_cast<Response::Error&>(dest))
-			.then([&](ByteReader& reader) {
-				return decode(reader, dest.errcode);
-			});
+	return decodeMessage(data, dest);
 }
 
 styxe::Result<ByteReader&>
 styxe::operator>> (ByteReader& data, _9P2000U::Response::Stat& dest) {
-	return decode(data, dest.dummySize, dest.data);
+	return decodeMessage(data, dest);
 }
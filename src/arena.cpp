@@ -0,0 +1,180 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/arena.hpp"
+#include "styxe/messageSchema.hpp"
+
+#include <cstring>  // std::memcpy
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+/// Re-point views of message fields at copies of the data in an arena.
+struct FieldCloner {
+	Arena&					arena;
+	styxe::Result<void>		result{types::okTag};
+
+	template<typename T>
+	void operator() (char const*, T& value) {
+		if (result) {
+			result = cloneField(value);
+		}
+	}
+
+	template<typename T>
+	styxe::Result<void> cloneField(T&) {
+		static_assert(FixedWireSize<T>::value != 0, "Field refers to message data and must be cloned");
+		return Ok();
+	}
+
+	styxe::Result<void> cloneField(StringView& value) {
+		return arena.copy(value)
+				.then([&value](StringView copy) { value = copy; });
+	}
+
+	styxe::Result<void> cloneField(MemoryView& value) {
+		return arena.copy(value)
+				.then([&value](MemoryView copy) { value = copy; });
+	}
+
+	styxe::Result<void> cloneField(WalkPath& value) {
+		return arena.copy(value.data())
+				.then([&value](MemoryView copy) { value = WalkPath{value.size(), copy}; });
+	}
+
+	styxe::Result<void> cloneField(QidSpan& value) {
+		return arena.copy(value.data())
+				.then([&value](MemoryView copy) { value = QidSpan{value.size(), copy}; });
+	}
+
+	styxe::Result<void> cloneField(Stat& value) {
+		for (auto field : {&value.name, &value.uid, &value.gid, &value.muid}) {
+			auto cloned = cloneField(*field);
+			if (!cloned) {
+				return cloned;
+			}
+		}
+
+		return Ok();
+	}
+
+	styxe::Result<void> cloneField(_9P2000U::StatEx& value) {
+		auto cloned = cloneField(static_cast<Stat&>(value));
+		if (!cloned) {
+			return cloned;
+		}
+
+		return cloneField(value.extension);
+	}
+};
+
+
+template<typename MessageType>
+styxe::Result<void>
+cloneFields(MessageType& message, Arena& arena) {
+	FieldCloner cloner{arena};
+	forEachField(message, cloner);
+
+	return mv(cloner.result);
+}
+
+
+styxe::Result<void>
+cloneFields(Response::Walk& message, Arena& arena) {
+	FieldCloner cloner{arena};
+	cloner("qids", message.qids);
+
+	return mv(cloner.result);
+}
+
+
+template<typename Variant>
+styxe::Result<Variant>
+cloneMessage(Variant const& message, Arena& arena) {
+	Variant result{message};
+	auto cloned = std::visit([&arena](auto& m) { return cloneFields(m, arena); }, result);
+	if (!cloned) {
+		return cloned.moveError();
+	}
+
+	return styxe::Result<Variant>{types::okTag, in_place, mv(result)};
+}
+
+}  // namespace
+
+
+styxe::Result<MutableMemoryView>
+Arena::allocate(size_type size) {
+	if (size > remaining()) {
+		return getCannedError(CannedError::NotEnoughSpace);
+	}
+
+	auto block = _buffer.slice(_used, _used + size);
+	_used += size;
+
+	return styxe::Result<MutableMemoryView>{types::okTag, in_place, block};
+}
+
+
+styxe::Result<MemoryView>
+Arena::copy(MemoryView data) {
+	return allocate(data.size())
+			.then([data](MutableMemoryView block) -> MemoryView {
+				if (!data.empty()) {
+					std::memcpy(block.dataAddress(), data.dataAddress(), data.size());
+				}
+
+				return block;
+			});
+}
+
+
+styxe::Result<StringView>
+Arena::copy(StringView str) {
+	return copy(wrapMemory(str.data(), str.size()))
+			.then([](MemoryView block) {
+				auto const chars = reinterpret_cast<char const*>(block.dataAddress());
+				return StringView{chars, narrow_cast<StringView::size_type>(block.size())};
+			});
+}
+
+
+styxe::Result<RequestMessage>
+styxe::clone(RequestMessage const& message, Arena& arena) {
+	auto const mark = arena.size();
+	auto result = cloneMessage(message, arena);
+	if (!result) {
+		arena.rewind(mark);  // Release fields copied before the arena ran out of space
+	}
+
+	return result;
+}
+
+
+styxe::Result<ResponseMessage>
+styxe::clone(ResponseMessage const& message, Arena& arena) {
+	auto const mark = arena.size();
+	auto result = cloneMessage(message, arena);
+	if (!result) {
+		arena.rewind(mark);  // Release fields copied before the arena ran out of space
+	}
+
+	return result;
+}
@@ -95,26 +95,3 @@ styxe::operator>> (Decoder& decoder, MemoryView& data) {
 }
 
 
-Result<Decoder&, Error>
-styxe::operator>> (Decoder& decoder, WalkPath& path) {
-	auto& buffer = decoder.buffer();
-	WalkPath::size_type componentsCount = 0;
-
-	auto result = buffer.readLE(componentsCount)
-			.then([&]() {
-				path = WalkPath{componentsCount, buffer.viewRemaining()};
-				// Advance the byteReader:
-				ByteReader::size_type skip = 0;
-				for (auto segment : path) {
-					skip += sizeof(styxe::var_datum_size_type) + segment.size();
-				}
-
-				return buffer.advance(skip);
-			});
-
-	if (!result) return result.moveError();
-
-	return Result<Decoder&, Error>{types::okTag, decoder};
-}
-
-
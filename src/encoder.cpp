@@ -18,6 +18,7 @@
 #include "styxe/9p.hpp"
 
 
+#include <solace/byteReader.hpp>
 #include <solace/utils.hpp>  // narrow_cast
 #include <limits>
 
@@ -66,6 +67,23 @@ styxe::protocolSize(MemoryView const& value) noexcept {
 }
 
 
+size_type
+styxe::protocolSize(WalkPath const& value) noexcept {
+	// Path segments are stored in the wire format already: skip over length prefixes of the segments in use,
+	// as the path memory may be larger than the segments it holds.
+	ByteReader reader{value.data()};
+	for (WalkPath::size_type i = 0; i < value.size(); ++i) {
+		var_datum_size_type segmentSize = 0;
+		if (!reader.readLE(segmentSize) || !reader.advance(segmentSize)) {
+			break;
+		}
+	}
+
+	return sizeof(WalkPath::size_type) +  // Number of path segments
+			narrow_cast<size_type>(reader.position());
+}
+
+
 
 
 Encoder&
@@ -38,6 +38,15 @@ static Error const kCannedErrors[] = {
 
 	CANNE(CannedError::NotEnoughData, "Ill-formed message: Declared frame size larger than message data received"),
 	CANNE(CannedError::MoreThenExpectedData, "Ill-formed message: Declared frame size less than message data received"),
+
+	CANNE(CannedError::IllFormedWalkPath, "Ill-formed message: Path segment contains '/' or NUL"),
+	CANNE(CannedError::IllFormedWalkPath_TooLong, "Ill-formed message: Path has more segments than allowed in a walk"),
+
+	CANNE(CannedError::NotEnoughSpace, "Message does not fit into the output buffer"),
+
+	CANNE(CannedError::TagsExhausted, "No free tags: too many requests in flight"),
+	CANNE(CannedError::UnexpectedTag, "Unexpected response: No request in flight with the tag"),
+	CANNE(CannedError::UnexpectedResponseType, "Unexpected response: Message type does not match the request"),
 };
 
 
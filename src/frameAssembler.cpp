@@ -0,0 +1,94 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/frameAssembler.hpp"
+#include "styxe/messageParser.hpp"
+
+#include <solace/utils.hpp>  // narrow_cast
+
+#include <algorithm>  // std::min
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+FrameAssembler::FrameAssembler(MutableMemoryView buffer, size_type maxMessageSize) noexcept
+	: _staging{buffer}
+	, _maxMessageSize{narrow_cast<size_type>(std::min<MemoryView::size_type>(maxMessageSize, buffer.size()))}
+{}
+
+
+void
+FrameAssembler::reset() noexcept {
+	_staging.rewind();
+}
+
+
+styxe::Result<MessageHeader>
+FrameAssembler::frameHeader(MemoryView data) const {
+	ByteReader reader{data};
+	auto maybeHeader = parseMessageHeader(reader);
+	if (!maybeHeader) {
+		return maybeHeader.moveError();
+	}
+
+	auto const header = *maybeHeader;
+	if (header.messageSize > _maxMessageSize) {
+		return getCannedError(CannedError::IllFormedHeader_TooBig);
+	}
+
+	return Ok(header);
+}
+
+
+styxe::Result<MemoryView>
+FrameAssembler::stage(MemoryView chunk) {
+	if (pending() < headerSize()) {
+		auto const bytesToCopy = std::min<MemoryView::size_type>(headerSize() - pending(), chunk.size());
+		_staging.write(chunk, bytesToCopy);
+		chunk = chunk.slice(bytesToCopy, chunk.size());
+
+		if (pending() < headerSize()) {  // Still not enough data to read a header
+			return Ok(chunk);
+		}
+
+		auto maybeHeader = frameHeader(_staging.viewWritten());
+		if (!maybeHeader) {
+			return maybeHeader.moveError();
+		}
+
+		_header = *maybeHeader;
+	}
+
+	// Note: frame size has been checked against the size of the staging buffer.
+	auto const bytesToCopy = std::min<MemoryView::size_type>(_header.messageSize - pending(), chunk.size());
+	_staging.write(chunk, bytesToCopy);
+
+	return Ok(chunk.slice(bytesToCopy, chunk.size()));
+}
+
+
+bool
+FrameAssembler::isStagedFrameComplete() const noexcept {
+	return (pending() >= headerSize()) && (pending() == _header.messageSize);
+}
+
+
+ByteReader
+FrameAssembler::stagedPayload() const noexcept {
+	return ByteReader{_staging.viewWritten().slice(headerSize(), _header.messageSize)};
+}
@@ -0,0 +1,75 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/ioVecWriter.hpp"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace {
+
+/// Size of the data size field, the only part of a data datum written into the output stream.
+constexpr size_type kDataSizeFieldSize = sizeof(size_type);
+
+size_type dataSize(MemoryView data) {
+	return narrow_cast<size_type>(data.size());
+}
+
+}  // namespace
+
+
+ResponseIoVecWriter&
+styxe::operator<< (ResponseIoVecWriter& writer, Response::Read const& message) {
+	writer.messageTypeOf<Response::Read>(kDataSizeFieldSize, message.data)
+			<< dataSize(message.data);
+
+	return writer;
+}
+
+
+ResponseIoVecWriter&
+styxe::operator<< (ResponseIoVecWriter& writer, _9P2000E::Response::ShortRead const& message) {
+	writer.messageTypeOf<_9P2000E::Response::ShortRead>(kDataSizeFieldSize, message.data)
+			<< dataSize(message.data);
+
+	return writer;
+}
+
+
+RequestIoVecWriter&
+styxe::operator<< (RequestIoVecWriter& writer, Request::Write const& message) {
+	auto const fieldsSize = protocolSize(message.fid) + protocolSize(message.offset) + kDataSizeFieldSize;
+	writer.messageTypeOf<Request::Write>(fieldsSize, message.data)
+			<< message.fid
+			<< message.offset
+			<< dataSize(message.data);
+
+	return writer;
+}
+
+
+RequestIoVecWriter&
+styxe::operator<< (RequestIoVecWriter& writer, _9P2000E::Request::ShortWrite const& message) {
+	auto const fieldsSize = protocolSize(message.fid) + protocolSize(message.path) + kDataSizeFieldSize;
+	writer.messageTypeOf<_9P2000E::Request::ShortWrite>(fieldsSize, message.data)
+			<< message.fid
+			<< message.path
+			<< dataSize(message.data);
+
+	return writer;
+}
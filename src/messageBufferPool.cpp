@@ -0,0 +1,157 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/messageBufferPool.hpp"
+
+#include <algorithm>  // std::max, std::min
+#include <new>  // placement new
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+/// Size of a block header, rounded up to keep buffer memory 16 bytes aligned.
+constexpr size_type kBlockHeaderSize = (sizeof(MessageBufferPool::Block) + 15) & ~size_type{15};
+
+/// log2 of the smallest buffer size.
+constexpr size_type kMinBufferSizeLog2 = 8;
+static_assert(MessageBufferPool::kMinBufferSize == 1 << kMinBufferSizeLog2, "Min buffer size must be a power of 2");
+
+}  // namespace
+
+
+void
+MessageBufferPool::Buffer::reset() noexcept {
+	if (_block) {
+		_pool->release(_block);
+		_block = nullptr;
+		_memory = {};
+	}
+}
+
+
+MessageBufferPool::MessageBufferPool(MemoryManager& memoryManager, size_type maxMessageSize)
+	: _memoryManager{memoryManager}
+	, _maxMessageSize{maxMessageSize}
+	, _owner{std::this_thread::get_id()}
+{
+	for (size_type size = kMinBufferSize; size < maxMessageSize && _nSizeClasses + 1 < kMaxSizeClasses; size *= 2) {
+		_classes[_nSizeClasses++].bufferSize = size;
+	}
+
+	_classes[_nSizeClasses++].bufferSize = maxMessageSize;
+}
+
+
+size_type
+MessageBufferPool::sizeClassOf(size_type size) const noexcept {
+	size_type index = 0;
+	for (auto bits = (size > 0 ? size - 1 : 0) >> kMinBufferSizeLog2; bits != 0; bits >>= 1) {
+		++index;
+	}
+
+	return std::min(index, _nSizeClasses - 1);
+}
+
+
+styxe::Result<MessageBufferPool::Buffer>
+MessageBufferPool::acquire(size_type size) {
+	if (size > _maxMessageSize) {
+		return getCannedError(CannedError::IllFormedHeader_TooBig);
+	}
+
+	auto const index = sizeClassOf(size);
+	auto& sizeClass = _classes[index];
+	if (!sizeClass.freeList) {
+		sizeClass.freeList = sizeClass.remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+	}
+
+	auto block = sizeClass.freeList;
+	if (block) {
+		sizeClass.freeList = block->next;
+	} else {
+		auto maybeBlock = allocate(index);
+		if (!maybeBlock) {
+			return maybeBlock.moveError();
+		}
+
+		block = maybeBlock.unwrap();
+	}
+
+	sizeClass.acquired += 1;
+	sizeClass.highWaterMark = std::max(sizeClass.highWaterMark, sizeClass.inUse());
+
+	_bytesAcquired += sizeClass.bufferSize;
+	auto const bytesInUse = _bytesAcquired - _bytesReleased - _bytesRemoteReleased.load(std::memory_order_relaxed);
+	_highWaterBytes = std::max(_highWaterBytes, bytesInUse);
+
+	return styxe::Result<Buffer>{types::okTag, in_place, *this, block, memoryOf(block)};
+}
+
+
+void
+MessageBufferPool::release(Block* block) noexcept {
+	auto& sizeClass = _classes[block->sizeClass];
+	if (std::this_thread::get_id() == _owner) {
+		block->next = sizeClass.freeList;
+		sizeClass.freeList = block;
+		sizeClass.released += 1;
+		_bytesReleased += sizeClass.bufferSize;
+	} else {
+		// Lock-free push: blocks are only ever popped by the owner thread taking the whole list at once.
+		block->next = sizeClass.remoteFreeList.load(std::memory_order_relaxed);
+		while (!sizeClass.remoteFreeList.compare_exchange_weak(block->next, block,
+															   std::memory_order_release,
+															   std::memory_order_relaxed)) {
+		}
+
+		sizeClass.remoteReleased.fetch_add(1, std::memory_order_relaxed);
+		_bytesRemoteReleased.fetch_add(sizeClass.bufferSize, std::memory_order_relaxed);
+	}
+}
+
+
+styxe::Result<MessageBufferPool::Block*>
+MessageBufferPool::allocate(size_type sizeClass) {
+	auto maybeMemory = _memoryManager.allocate(kBlockHeaderSize + _classes[sizeClass].bufferSize);
+	if (!maybeMemory) {
+		return maybeMemory.moveError();
+	}
+
+	_memory.emplace_back(mv(maybeMemory.unwrap()));
+	auto block = new (_memory.back().view().dataAddress()) Block{nullptr, sizeClass};
+	_classes[sizeClass].allocated += 1;
+
+	return Ok(block);
+}
+
+
+MutableMemoryView
+MessageBufferPool::memoryOf(Block* block) noexcept {
+	return wrapMemory(reinterpret_cast<byte*>(block) + kBlockHeaderSize, _classes[block->sizeClass].bufferSize);
+}
+
+
+MessageBufferPool::Stats
+MessageBufferPool::stats(size_type sizeClass) const {
+	assertIndexInRange(sizeClass, _nSizeClasses, "MessageBufferPool::stats");
+
+	auto const& c = _classes[sizeClass];
+	return {c.bufferSize, c.allocated, c.inUse(), c.highWaterMark};
+}
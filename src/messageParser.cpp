@@ -26,70 +26,107 @@ const size_type styxe::kMinMessageSize = 4145;			/// Min space for TWalk of 16*2
 
 
 
-styxe::Result<RequestMessage>
-invalidRequestType(ByteReader& ) {
-	return styxe::Result<RequestMessage>{types::errTag, getCannedError(CannedError::UnsupportedMessageType)};
-}
+template<typename Table>
+constexpr Table
+makeBlankTable(typename Table::value_type invalidType) noexcept {
+	Table table{};
+	for (auto& entry : table) {
+		entry = invalidType;
+	}
 
-styxe::Result<ResponseMessage>
-invalidResponseType(ByteReader& ) {
-	return styxe::Result<ResponseMessage>{types::errTag, getCannedError(CannedError::UnsupportedMessageType)};
+	return table;
 }
 
 
-template<typename T>
-styxe::Result<RequestMessage>
-parseRequest(ByteReader& data) {
-	T msg{};  // This requires default constructor for all Response::* types
+/// Parse functions that return a parsed message.
+struct ReturnParsed {
+	using RequestTable = RequestParseTable;
+	using ResponseTable = ResponseParseTable;
 
-	auto result = data >> msg;
-	if (!result) {
-		return result.moveError();
+	template<typename T>
+	static styxe::Result<RequestMessage> request(ByteReader& data) {
+		T msg{};  // This requires default constructor for all Request::* types
+
+		auto result = data >> msg;
+		if (!result) {
+			return result.moveError();
+		}
+
+		return styxe::Result<RequestMessage>{types::okTag, in_place, mv(msg)};
 	}
 
-	return styxe::Result<RequestMessage>{types::okTag, in_place, mv(msg)};
-}
+	template<typename T>
+	static styxe::Result<ResponseMessage> response(ByteReader& data) {
+		T msg{};  // This requires default constructor for all Response::* types
 
-template<typename T>
-styxe::Result<ResponseMessage>
-parseResponse(ByteReader& data) {
-	T msg{};  // This requires default constructor for all Response::* types
+		auto result = data >> msg;
+		if (!result) {
+			return result.moveError();
+		}
 
-	auto result = data >> msg;
-	if (!result) {
-		return result.moveError();
+		return styxe::Result<ResponseMessage>{types::okTag, in_place, mv(msg)};
 	}
 
-	return styxe::Result<ResponseMessage>{types::okTag, in_place, mv(msg)};
-}
+	static styxe::Result<RequestMessage> invalidRequest(ByteReader& ) {
+		return styxe::Result<RequestMessage>{types::errTag, getCannedError(CannedError::UnsupportedMessageType)};
+	}
 
+	static styxe::Result<ResponseMessage> invalidResponse(ByteReader& ) {
+		return styxe::Result<ResponseMessage>{types::errTag, getCannedError(CannedError::UnsupportedMessageType)};
+	}
 
-ResponseParseTable
-getBlankResponseParserTable() noexcept {
-	ResponseParseTable table;
-	table.fill(invalidResponseType);
+	static constexpr RequestTable blankRequestTable() noexcept { return makeBlankTable<RequestTable>(invalidRequest); }
+	static constexpr ResponseTable blankResponseTable() noexcept {
+		return makeBlankTable<ResponseTable>(invalidResponse);
+	}
+};
 
-	return table;
-}
 
-RequestParseTable
-getBlankRequestParserTable() noexcept {
-	RequestParseTable table;
-	table.fill(invalidRequestType);
+/// Parse functions that emplace a parsed message into caller's storage.
+struct EmplaceParsed {
+	using RequestTable = RequestParseIntoTable;
+	using ResponseTable = ResponseParseIntoTable;
 
-	return table;
-}
+	template<typename T, typename MessageVariant>
+	static styxe::Result<void> parseInto(ByteReader& data, MessageVariant& out) {
+		auto result = data >> out.template emplace<T>();
+		if (!result) {
+			return result.moveError();
+		}
+
+		return Ok();
+	}
+
+	template<typename T>
+	static styxe::Result<void> request(ByteReader& data, RequestMessage& out) { return parseInto<T>(data, out); }
+
+	template<typename T>
+	static styxe::Result<void> response(ByteReader& data, ResponseMessage& out) { return parseInto<T>(data, out); }
+
+	template<typename MessageVariant>
+	static styxe::Result<void> invalidType(ByteReader& , MessageVariant& ) {
+		return getCannedError(CannedError::UnsupportedMessageType);
+	}
+
+	static constexpr RequestTable blankRequestTable() noexcept {
+		return makeBlankTable<RequestTable>(invalidType<RequestMessage>);
+	}
+	static constexpr ResponseTable blankResponseTable() noexcept {
+		return makeBlankTable<ResponseTable>(invalidType<ResponseMessage>);
+	}
+};
 
 
 
 namespace styxe::_9P2000 {
 
-RequestParseTable
-getRequestParserTable() noexcept {
-	auto table = getBlankRequestParserTable();
+template<typename Policy>
+constexpr typename Policy::RequestTable
+makeRequestParserTable() noexcept {
+	auto table = Policy::blankRequestTable();
 
 #define FILL_REQUEST(message) \
-	table[asByte(MessageType::T##message)] = parseRequest<Request::message>
+	table[asByte(MessageType::T##message)] = Policy::template request<Request::message>
 
 	FILL_REQUEST(Version);
 	FILL_REQUEST(Auth);
@@ -104,17 +141,18 @@ getRequestParserTable() noexcept {
 	FILL_REQUEST(Remove);
 	FILL_REQUEST(Stat);
 	FILL_REQUEST(WStat);
-#undef FILL_RESPONSE
+#undef FILL_REQUEST
 
 	return table;
 }
 
-ResponseParseTable
-getResponseParserTable() noexcept {
-	auto table = getBlankResponseParserTable();
+template<typename Policy>
+constexpr typename Policy::ResponseTable
+makeResponseParserTable() noexcept {
+	auto table = Policy::blankResponseTable();
 
 #define FILL_RESPONSE(message) \
-	table[asByte(MessageType::R##message)] = parseResponse<Response::message>
+	table[asByte(MessageType::R##message)] = Policy::template response<Response::message>
 
 	FILL_RESPONSE(Version);
 	FILL_RESPONSE(Auth);
@@ -135,34 +173,47 @@ getResponseParserTable() noexcept {
 	return table;
 }
 
+/// Parser tables are built at compile time and shared by all parsers of the protocol version.
+constexpr RequestParseTable kRequestParserTable = makeRequestParserTable<ReturnParsed>();
+constexpr ResponseParseTable kResponseParserTable = makeResponseParserTable<ReturnParsed>();
+constexpr RequestParseIntoTable kRequestParseIntoTable = makeRequestParserTable<EmplaceParsed>();
+constexpr ResponseParseIntoTable kResponseParseIntoTable = makeResponseParserTable<EmplaceParsed>();
+
 }  // namespace styxe::_9P2000
 
 
 
 namespace styxe::_9P2000U {
 
-RequestParseTable
-getRequestParserTable() noexcept {
-	auto table = ::_9P2000::getRequestParserTable();
+template<typename Policy>
+constexpr typename Policy::RequestTable
+makeRequestParserTable() noexcept {
+	auto table = ::_9P2000::makeRequestParserTable<Policy>();
 
-	table[asByte(::styxe::MessageType::TAuth)] = parseRequest<_9P2000U::Request::Auth>;
-	table[asByte(::styxe::MessageType::TAttach)] = parseRequest<_9P2000U::Request::Attach>;
-	table[asByte(::styxe::MessageType::TCreate)] = parseRequest<_9P2000U::Request::Create>;
-	table[asByte(::styxe::MessageType::TWStat)] = parseRequest<_9P2000U::Request::WStat>;
+	table[asByte(::styxe::MessageType::TAuth)] = Policy::template request<_9P2000U::Request::Auth>;
+	table[asByte(::styxe::MessageType::TAttach)] = Policy::template request<_9P2000U::Request::Attach>;
+	table[asByte(::styxe::MessageType::TCreate)] = Policy::template request<_9P2000U::Request::Create>;
+	table[asByte(::styxe::MessageType::TWStat)] = Policy::template request<_9P2000U::Request::WStat>;
 
 	return table;
 }
 
-ResponseParseTable
-getResponseParserTable() noexcept {
-	auto table = ::_9P2000::getResponseParserTable();
+template<typename Policy>
+constexpr typename Policy::ResponseTable
+makeResponseParserTable() noexcept {
+	auto table = ::_9P2000::makeResponseParserTable<Policy>();
 
-	table[asByte(::styxe::MessageType::RError)] = parseResponse<_9P2000U::Response::Error>;
-	table[asByte(::styxe::MessageType::RStat)] = parseResponse<_9P2000U::Response::Stat>;
+	table[asByte(::styxe::MessageType::RError)] = Policy::template response<_9P2000U::Response::Error>;
+	table[asByte(::styxe::MessageType::RStat)] = Policy::template response<_9P2000U::Response::Stat>;
 
 	return table;
 }
 
+constexpr RequestParseTable kRequestParserTable = makeRequestParserTable<ReturnParsed>();
+constexpr ResponseParseTable kResponseParserTable = makeResponseParserTable<ReturnParsed>();
+constexpr RequestParseIntoTable kRequestParseIntoTable = makeRequestParserTable<EmplaceParsed>();
+constexpr ResponseParseIntoTable kResponseParseIntoTable = makeResponseParserTable<EmplaceParsed>();
+
 }  // namespace styxe::_9P2000U
 
 
@@ -171,28 +222,35 @@ getResponseParserTable() noexcept {
 //----------------------------------------------------------------------------------------------------------------------
 namespace styxe::_9P2000E {
 
-RequestParseTable
-getRequestParserTable() noexcept {
-	auto table = ::_9P2000::getRequestParserTable();
+template<typename Policy>
+constexpr typename Policy::RequestTable
+makeRequestParserTable() noexcept {
+	auto table = ::_9P2000::makeRequestParserTable<Policy>();
 
-	table[asByte(MessageType::TSession)] = parseRequest<Request::Session>;
-	table[asByte(MessageType::TShortRead)] = parseRequest<Request::ShortRead>;
-	table[asByte(MessageType::TShortWrite)] = parseRequest<Request::ShortWrite>;
+	table[asByte(MessageType::TSession)] = Policy::template request<Request::Session>;
+	table[asByte(MessageType::TShortRead)] = Policy::template request<Request::ShortRead>;
+	table[asByte(MessageType::TShortWrite)] = Policy::template request<Request::ShortWrite>;
 
 	return table;
 }
 
-ResponseParseTable
-getResponseParserTable() noexcept {
-	auto table = ::_9P2000::getResponseParserTable();
+template<typename Policy>
+constexpr typename Policy::ResponseTable
+makeResponseParserTable() noexcept {
+	auto table = ::_9P2000::makeResponseParserTable<Policy>();
 
-	table[asByte(MessageType::RSession)] = parseResponse<Response::Session>;
-	table[asByte(MessageType::RShortRead)] = parseResponse<Response::ShortRead>;
-	table[asByte(MessageType::RShortWrite)] = parseResponse<Response::ShortWrite>;
+	table[asByte(MessageType::RSession)] = Policy::template response<Response::Session>;
+	table[asByte(MessageType::RShortRead)] = Policy::template response<Response::ShortRead>;
+	table[asByte(MessageType::RShortWrite)] = Policy::template response<Response::ShortWrite>;
 
 	return table;
 }
 
+constexpr RequestParseTable kRequestParserTable = makeRequestParserTable<ReturnParsed>();
+constexpr ResponseParseTable kResponseParserTable = makeResponseParserTable<ReturnParsed>();
+constexpr RequestParseIntoTable kRequestParseIntoTable = makeRequestParserTable<EmplaceParsed>();
+constexpr ResponseParseIntoTable kResponseParseIntoTable = makeResponseParserTable<EmplaceParsed>();
+
 }  // namespace styxe::_9P2000E
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -200,62 +258,69 @@ getResponseParserTable() noexcept {
 //----------------------------------------------------------------------------------------------------------------------
 namespace styxe::_9P2000L {
 
-RequestParseTable
-getRequestParserTable() noexcept {
-	auto table = _9P2000U::getRequestParserTable();
-
-	table[asByte(MessageType::Tstatfs)] = parseRequest<Request::StatFS>;
-	table[asByte(MessageType::Tlopen)] = parseRequest<Request::LOpen>;
-	table[asByte(MessageType::Tlcreate)] = parseRequest<Request::LCreate>;
-	table[asByte(MessageType::Tsymlink)] = parseRequest<Request::Symlink>;
-	table[asByte(MessageType::Tmknod)] = parseRequest<Request::MkNode>;
-	table[asByte(MessageType::Trename)] = parseRequest<Request::Rename>;
-	table[asByte(MessageType::Treadlink)] = parseRequest<Request::ReadLink>;
-	table[asByte(MessageType::Tgetattr)] = parseRequest<Request::GetAttr>;
-	table[asByte(MessageType::Tsetattr)] = parseRequest<Request::SetAttr>;
-	table[asByte(MessageType::Txattrwalk)] = parseRequest<Request::XAttrWalk>;
-	table[asByte(MessageType::Txattrcreate)] = parseRequest<Request::XAttrCreate>;
-	table[asByte(MessageType::Treaddir)] = parseRequest<Request::ReadDir>;
-	table[asByte(MessageType::Tfsync)] = parseRequest<Request::FSync>;
-	table[asByte(MessageType::Tlock)] = parseRequest<Request::Lock>;
-	table[asByte(MessageType::Tgetlock)] = parseRequest<Request::GetLock>;
-	table[asByte(MessageType::Tlink)] = parseRequest<Request::Link>;
-	table[asByte(MessageType::Tmkdir)] = parseRequest<Request::MkDir>;
-	table[asByte(MessageType::Trenameat)] = parseRequest<Request::RenameAt>;
-	table[asByte(MessageType::Tunlinkat)] = parseRequest<Request::UnlinkAt>;
+template<typename Policy>
+constexpr typename Policy::RequestTable
+makeRequestParserTable() noexcept {
+	auto table = _9P2000U::makeRequestParserTable<Policy>();
+
+	table[asByte(MessageType::Tstatfs)] = Policy::template request<Request::StatFS>;
+	table[asByte(MessageType::Tlopen)] = Policy::template request<Request::LOpen>;
+	table[asByte(MessageType::Tlcreate)] = Policy::template request<Request::LCreate>;
+	table[asByte(MessageType::Tsymlink)] = Policy::template request<Request::Symlink>;
+	table[asByte(MessageType::Tmknod)] = Policy::template request<Request::MkNode>;
+	table[asByte(MessageType::Trename)] = Policy::template request<Request::Rename>;
+	table[asByte(MessageType::Treadlink)] = Policy::template request<Request::ReadLink>;
+	table[asByte(MessageType::Tgetattr)] = Policy::template request<Request::GetAttr>;
+	table[asByte(MessageType::Tsetattr)] = Policy::template request<Request::SetAttr>;
+	table[asByte(MessageType::Txattrwalk)] = Policy::template request<Request::XAttrWalk>;
+	table[asByte(MessageType::Txattrcreate)] = Policy::template request<Request::XAttrCreate>;
+	table[asByte(MessageType::Treaddir)] = Policy::template request<Request::ReadDir>;
+	table[asByte(MessageType::Tfsync)] = Policy::template request<Request::FSync>;
+	table[asByte(MessageType::Tlock)] = Policy::template request<Request::Lock>;
+	table[asByte(MessageType::Tgetlock)] = Policy::template request<Request::GetLock>;
+	table[asByte(MessageType::Tlink)] = Policy::template request<Request::Link>;
+	table[asByte(MessageType::Tmkdir)] = Policy::template request<Request::MkDir>;
+	table[asByte(MessageType::Trenameat)] = Policy::template request<Request::RenameAt>;
+	table[asByte(MessageType::Tunlinkat)] = Policy::template request<Request::UnlinkAt>;
 
 	return table;
 }
 
 
-ResponseParseTable
-getResponseParserTable() noexcept {
-	auto table = _9P2000U::getResponseParserTable();
-
-	table[asByte(MessageType::Rlerror)] = parseResponse<Response::LError>;
-	table[asByte(MessageType::Rstatfs)] = parseResponse<Response::StatFS>;
-	table[asByte(MessageType::Rlopen)] = parseResponse<Response::LOpen>;
-	table[asByte(MessageType::Rlcreate)] = parseResponse<Response::LCreate>;
-	table[asByte(MessageType::Rsymlink)] = parseResponse<Response::Symlink>;
-	table[asByte(MessageType::Rmknod)] = parseResponse<Response::MkNode>;
-	table[asByte(MessageType::Rrename)] = parseResponse<Response::Rename>;
-	table[asByte(MessageType::Rreadlink)] = parseResponse<Response::ReadLink>;
-	table[asByte(MessageType::Rgetattr)] = parseResponse<Response::GetAttr>;
-	table[asByte(MessageType::Rsetattr)] = parseResponse<Response::SetAttr>;
-	table[asByte(MessageType::Rxattrwalk)] = parseResponse<Response::XAttrWalk>;
-	table[asByte(MessageType::Rxattrcreate)] = parseResponse<Response::XAttrCreate>;
-	table[asByte(MessageType::Rreaddir)] = parseResponse<Response::ReadDir>;
-	table[asByte(MessageType::Rfsync)] = parseResponse<Response::FSync>;
-	table[asByte(MessageType::Rlock)] = parseResponse<Response::Lock>;
-	table[asByte(MessageType::Rgetlock)] = parseResponse<Response::GetLock>;
-	table[asByte(MessageType::Rlink)] = parseResponse<Response::Link>;
-	table[asByte(MessageType::Rmkdir)] = parseResponse<Response::MkDir>;
-	table[asByte(MessageType::Rrenameat)] = parseResponse<Response::RenameAt>;
-	table[asByte(MessageType::Runlinkat)] = parseResponse<Response::UnlinkAt>;
+template<typename Policy>
+constexpr typename Policy::ResponseTable
+makeResponseParserTable() noexcept {
+	auto table = _9P2000U::makeResponseParserTable<Policy>();
+
+	table[asByte(MessageType::Rlerror)] = Policy::template response<Response::LError>;
+	table[asByte(MessageType::Rstatfs)] = Policy::template response<Response::StatFS>;
+	table[asByte(MessageType::Rlopen)] = Policy::template response<Response::LOpen>;
+	table[asByte(MessageType::Rlcreate)] = Policy::template response<Response::LCreate>;
+	table[asByte(MessageType::Rsymlink)] = Policy::template response<Response::Symlink>;
+	table[asByte(MessageType::Rmknod)] = Policy::template response<Response::MkNode>;
+	table[asByte(MessageType::Rrename)] = Policy::template response<Response::Rename>;
+	table[asByte(MessageType::Rreadlink)] = Policy::template response<Response::ReadLink>;
+	table[asByte(MessageType::Rgetattr)] = Policy::template response<Response::GetAttr>;
+	table[asByte(MessageType::Rsetattr)] = Policy::template response<Response::SetAttr>;
+	table[asByte(MessageType::Rxattrwalk)] = Policy::template response<Response::XAttrWalk>;
+	table[asByte(MessageType::Rxattrcreate)] = Policy::template response<Response::XAttrCreate>;
+	table[asByte(MessageType::Rreaddir)] = Policy::template response<Response::ReadDir>;
+	table[asByte(MessageType::Rfsync)] = Policy::template response<Response::FSync>;
+	table[asByte(MessageType::Rlock)] = Policy::template response<Response::Lock>;
+	table[asByte(MessageType::Rgetlock)] = Policy::template response<Response::GetLock>;
+	table[asByte(MessageType::Rlink)] = Policy::template response<Response::Link>;
+	table[asByte(MessageType::Rmkdir)] = Policy::template response<Response::MkDir>;
+	table[asByte(MessageType::Rrenameat)] = Policy::template response<Response::RenameAt>;
+	table[asByte(MessageType::Runlinkat)] = Policy::template response<Response::UnlinkAt>;
 
 	return table;
 }
 
+constexpr RequestParseTable kRequestParserTable = makeRequestParserTable<ReturnParsed>();
+constexpr ResponseParseTable kResponseParserTable = makeResponseParserTable<ReturnParsed>();
+constexpr RequestParseIntoTable kRequestParseIntoTable = makeRequestParserTable<EmplaceParsed>();
+constexpr ResponseParseIntoTable kResponseParseIntoTable = makeResponseParserTable<EmplaceParsed>();
+
 }  // namespace styxe::_9P2000L
 
 
@@ -263,6 +328,18 @@ getResponseParserTable() noexcept {
 // Parser implementation
 //----------------------------------------------------------------------------------------------------------------------
 
+size_type
+styxe::messageSize(RequestMessage const& message) noexcept {
+	return std::visit([](auto const& request) noexcept { return messageSize(request); }, message);
+}
+
+
+size_type
+styxe::messageSize(ResponseMessage const& message) noexcept {
+	return std::visit([](auto const& response) noexcept { return messageSize(response); }, message);
+}
+
+
 Solace::Result<void, Error>
 styxe::validateHeader(MessageHeader header, ByteReader::size_type dataAvailible, size_type maxMessageSize) noexcept {
 	auto const mandatoryHeaderSize = headerSize();
@@ -340,22 +417,54 @@ ResponseParser::parseResponse(MessageHeader header, ByteReader& data) const {
 	if (!isValid)
 		return isValid.moveError();
 
-	auto& decoder = _versionedResponseParser[header.type];
+	auto& decoder = (*_versionedResponseParser)[header.type];
 	return decoder(data);
 }
 
 
+styxe::Result<void>
+ResponseParser::parseResponse(MessageHeader header, ByteReader& data, ResponseMessage& out) const {
+	if (!_versionedResponseParserInto) {  // Parser constructed with a custom table only
+		return parseResponse(header, data)
+				.then([&out](ResponseMessage&& message) { out = mv(message); });
+	}
+
+	auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+	if (!isValid)
+		return isValid.moveError();
+
+	auto& decoder = (*_versionedResponseParserInto)[header.type];
+	return decoder(data, out);
+}
+
+
 styxe::Result<RequestMessage>
 RequestParser::parseRequest(MessageHeader header, ByteReader& data) const {
 	auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
 	if (!isValid)
 		return isValid.moveError();
 
-	auto& decoder = _versionedRequestParser[header.type];
+	auto& decoder = (*_versionedRequestParser)[header.type];
 	return decoder(data);
 }
 
 
+styxe::Result<void>
+RequestParser::parseRequest(MessageHeader header, ByteReader& data, RequestMessage& out) const {
+	if (!_versionedRequestParserInto) {  // Parser constructed with a custom table only
+		return parseRequest(header, data)
+				.then([&out](RequestMessage&& message) { out = mv(message); });
+	}
+
+	auto isValid = validateHeader(header, data.remaining(), maxMessageSize());
+	if (!isValid)
+		return isValid.moveError();
+
+	auto& decoder = (*_versionedRequestParserInto)[header.type];
+	return decoder(data, out);
+}
+
+
 StringView
 ParserBase::messageName(byte messageType) const noexcept {
 	return _nameMapper(messageType);
@@ -368,19 +477,23 @@ styxe::createResponseParser(Solace::StringView version, size_type maxPayloadSize
 	if (version == kProtocolVersion) {
 		return styxe::Result<ResponseParser>{types::okTag, in_place, maxPayloadSize,
 					messageTypeToString,
-					_9P2000::getResponseParserTable()};
+					_9P2000::kResponseParserTable,
+					_9P2000::kResponseParseIntoTable};
 	} else if (version == _9P2000U::kProtocolVersion) {
 		return styxe::Result<ResponseParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000U::messageTypeToString,
-					_9P2000U::getResponseParserTable()};
+					_9P2000U::kResponseParserTable,
+					_9P2000U::kResponseParseIntoTable};
 	} else if (version == _9P2000E::kProtocolVersion) {
 		return styxe::Result<ResponseParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000E::messageTypeToString,
-					_9P2000E::getResponseParserTable()};
+					_9P2000E::kResponseParserTable,
+					_9P2000E::kResponseParseIntoTable};
 	} else if (version == _9P2000L::kProtocolVersion) {
 		return styxe::Result<ResponseParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000L::messageTypeToString,
-					_9P2000L::getResponseParserTable()};
+					_9P2000L::kResponseParserTable,
+					_9P2000L::kResponseParseIntoTable};
 	}
 
 	return styxe::Result<ResponseParser>{types::errTag, in_place,
@@ -393,19 +506,23 @@ styxe::createRequestParser(StringView version, size_type maxPayloadSize) noexcep
 	if (version == kProtocolVersion) {
 		return styxe::Result<RequestParser>{types::okTag, in_place, maxPayloadSize,
 					messageTypeToString,
-					_9P2000::getRequestParserTable()};
+					_9P2000::kRequestParserTable,
+					_9P2000::kRequestParseIntoTable};
 	} else if (version == _9P2000U::kProtocolVersion) {
 		return styxe::Result<RequestParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000U::messageTypeToString,
-					_9P2000U::getRequestParserTable()};
+					_9P2000U::kRequestParserTable,
+					_9P2000U::kRequestParseIntoTable};
 	} else if (version == _9P2000E::kProtocolVersion) {
 		return styxe::Result<RequestParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000E::messageTypeToString,
-					_9P2000E::getRequestParserTable()};
+					_9P2000E::kRequestParserTable,
+					_9P2000E::kRequestParseIntoTable};
 	} else if (version == _9P2000L::kProtocolVersion) {
 		return styxe::Result<RequestParser>{types::okTag, in_place, maxPayloadSize,
 					_9P2000L::messageTypeToString,
-					_9P2000L::getRequestParserTable()};
+					_9P2000L::kRequestParserTable,
+					_9P2000L::kRequestParseIntoTable};
 	}
 
 	return styxe::Result<RequestParser>{types::errTag, in_place,
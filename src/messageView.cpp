@@ -0,0 +1,173 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/messageView.hpp"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace {
+
+styxe::Result<void>
+skipBytes(ByteReader& data, size_type nBytes) {
+	if (data.remaining() < nBytes) {
+		return getCannedError(CannedError::NotEnoughData);
+	}
+
+	data.position(data.position() + nBytes);
+	return Ok();
+}
+
+
+/**
+ * Skip a number of length prefixed strings.
+ * @param data Byte stream to read strings from.
+ * @param count Number of strings to skip.
+ * @param offsets Offsets of the skipped strings and of the data that follows them, `count + 1` entries.
+ * @return Ok or an error if the data has less then `count` strings.
+ */
+styxe::Result<void>
+skipStrings(ByteReader& data, size_type count, size_type* offsets) {
+	for (size_type i = 0; i < count; ++i) {
+		offsets[i] = narrow_cast<size_type>(data.position());
+
+		var_datum_size_type dataSize = 0;
+		auto result = data.readLE(dataSize);
+		if (!result) {
+			return getCannedError(CannedError::NotEnoughData);
+		}
+
+		auto skipped = skipBytes(data, dataSize);
+		if (!skipped) {
+			return skipped.moveError();
+		}
+	}
+
+	offsets[count] = narrow_cast<size_type>(data.position());
+	return Ok();
+}
+
+
+/// Validate that the data holds a message of the layout checked by `validate` and consume it.
+template<typename F>
+styxe::Result<MemoryView>
+captureMessage(ByteReader& data, F&& validate) {
+	auto const message = data.viewRemaining();
+	ByteReader reader{message};
+	auto isValid = validate(reader);
+	if (!isValid) {
+		return isValid.moveError();
+	}
+
+	data.position(data.position() + reader.position());
+	return Ok(message.slice(0, reader.position()));
+}
+
+}  // namespace
+
+
+styxe::Result<ByteReader&>
+styxe::operator>> (ByteReader& data, WalkView& dest) {
+	WalkPathIndex path;
+	auto maybeMessage = captureMessage(data, [&path](ByteReader& reader) -> styxe::Result<void> {
+		auto result = skipBytes(reader, fieldOffset<&Request::Walk::path>());
+		if (!result) {
+			return result;
+		}
+
+		Decoder decoder{reader};
+		auto decoded = decoder >> path;
+		if (!decoded) {
+			return decoded.moveError();
+		}
+
+		return Ok();
+	});
+
+	if (!maybeMessage) {
+		return maybeMessage.moveError();
+	}
+
+	dest = WalkView{*maybeMessage, path};
+	return styxe::Result<ByteReader&>{types::okTag, data};
+}
+
+
+styxe::Result<ByteReader&>
+styxe::operator>> (ByteReader& data, WStatView& dest) {
+	WStatView::StringOffsets stringOffsets{};
+	auto maybeMessage = captureMessage(data, [&stringOffsets](ByteReader& reader) -> styxe::Result<void> {
+		auto result = skipBytes(reader, WStatView::kNameOffset);
+		if (!result) {
+			return result;
+		}
+
+		// name, uid, gid, muid
+		return skipStrings(reader, 4, stringOffsets.data());
+	});
+
+	if (!maybeMessage) {
+		return maybeMessage.moveError();
+	}
+
+	dest = WStatView{*maybeMessage, stringOffsets};
+	return styxe::Result<ByteReader&>{types::okTag, data};
+}
+
+
+styxe::Result<ByteReader&>
+styxe::operator>> (ByteReader& data, _9P2000U::WStatView& dest) {
+	_9P2000U::WStatView::StringOffsets stringOffsets{};
+	auto maybeMessage = captureMessage(data, [&stringOffsets](ByteReader& reader) -> styxe::Result<void> {
+		auto result = skipBytes(reader, _9P2000U::WStatView::kNameOffset);
+		if (!result) {
+			return result;
+		}
+
+		// name, uid, gid, muid, extension
+		result = skipStrings(reader, _9P2000U::WStatView::kMaxStrings, stringOffsets.data());
+		if (!result) {
+			return result;
+		}
+
+		// n_uid, n_gid, n_muid
+		return skipBytes(reader, 3*sizeof(uint32));
+	});
+
+	if (!maybeMessage) {
+		return maybeMessage.moveError();
+	}
+
+	dest = _9P2000U::WStatView{*maybeMessage, stringOffsets};
+	return styxe::Result<ByteReader&>{types::okTag, data};
+}
+
+
+styxe::Result<ByteReader&>
+styxe::operator>> (ByteReader& data, _9P2000L::GetAttrView& dest) {
+	auto maybeMessage = captureMessage(data, [](ByteReader& reader) {
+		return skipBytes(reader, _9P2000L::GetAttrView::kPayloadSize);
+	});
+
+	if (!maybeMessage) {
+		return maybeMessage.moveError();
+	}
+
+	dest = _9P2000L::GetAttrView{*maybeMessage};
+	return styxe::Result<ByteReader&>{types::okTag, data};
+}
@@ -15,13 +15,19 @@
 */
 
 #include "styxe/messageWriter.hpp"
+#include "styxe/9p2000.hpp"  // Encoding of Qid
+
+#include "write_helper.hpp"
+
+#include <algorithm>  // std::min
+#include <limits>
 
 
 using namespace Solace;
 using namespace styxe;
 
 
-void MessageWriterBase::updateMessageSize() {
+void MessageWriterBase::writeMessageSize() {
 	auto const finalPos = _encoder.buffer().position();
 	auto const messageSize = finalPos - _pos;  // Re-compute actual message size
 	if (finalPos == _pos || _header.messageSize == messageSize) {  // Nothing to do
@@ -44,24 +50,66 @@ void MessageWriterBase::updateMessageSize() {
 
 ByteWriter&
 MessageWriterBase::build() {
-	updateMessageSize();
+	writeMessageSize();
 
 	return _encoder.buffer().flip();
 }
 
 
+namespace {
+
+/// Get a view of the output buffer for a message to grow by at most maxBytes without exceeding maxMessageSize.
+MutableMemoryView
+reserveSpace(MessageWriterBase& writer, size_type maxBytes, size_type maxMessageSize) {
+	auto const messageSize = writer.bytesWritten();
+	auto const messageCapacity = (maxMessageSize > messageSize) ? maxMessageSize - messageSize : 0;
+	auto const remaining = writer.encoder().buffer().viewRemaining();
+
+	return remaining.slice(0, std::min<MutableMemoryView::size_type>({maxBytes, messageCapacity, remaining.size()}));
+}
+
+}  // namespace
+
+
 void
 PartialPathWriter::segment(Solace::StringView value) {
-	auto& buffer = _writer.encoder().buffer();
-	auto const finalPos = buffer.position();
-	buffer.position(_segmentsPos);  // Reset output stream to the start position
-
 	_nSegments += 1;
-	_writer.encoder() << _nSegments;
+	_writer.encoder() << value;
+
+	if (!_writer.isSizeUpdateDeferred()) {
+		patchCounter(_writer.encoder(), _segmentsPos, _nSegments);
+		_writer.updateMessageSize();
+	}
+}
+
+
+RequestWriter&
+PartialPathWriter::finish() {
+	patchCounter(_writer.encoder(), _segmentsPos, _nSegments);
+	_writer.finish();
+
+	return _writer;
+}
+
 
-	buffer.position(finalPos);  // Reset output stream to the final position
+void
+PartialQidWriter::qid(Qid const& value) {
+	_nQids += 1;
 	_writer.encoder() << value;
-	_writer.updateMessageSize();
+
+	if (!_writer.isSizeUpdateDeferred()) {
+		patchCounter(_writer.encoder(), _qidsPos, _nQids);
+		_writer.updateMessageSize();
+	}
+}
+
+
+ResponseWriter&
+PartialQidWriter::finish() {
+	patchCounter(_writer.encoder(), _qidsPos, _nQids);
+	_writer.finish();
+
+	return _writer;
 }
 
 
@@ -75,11 +123,14 @@ PartialDataWriter::viewRemainder() {
 MessageWriterBase&
 PartialDataWriter::update(size_type dataSize) {
 	auto& buffer = _writer.encoder().buffer();
+	auto const dataPos = _segmentsPos + sizeof(size_type);
+	assertIndexInRange(dataSize, size_type{0}, narrow_cast<size_type>(buffer.limit() - dataPos + 1),
+					   "PartialDataWriter::update");
 	_dataSize = dataSize;
 
 	buffer.position(_segmentsPos);  // Reset output stream to the start position
 	_writer.encoder() << _dataSize;
-	buffer.advance(_dataSize);  // TODO(abbyssoul): error check, new dataSize can be over the buffer capacity
+	buffer.advance(_dataSize);
 	_writer.updateMessageSize();
 
 	return _writer;
@@ -91,22 +142,102 @@ PartialDataWriter::data(MemoryView value) {
 	auto& buffer = _writer.encoder().buffer();
 	buffer.write(value);
 
+	if (_writer.isSizeUpdateDeferred()) {
+		_dataSize += narrow_cast<size_type>(value.size());
+		return _writer;
+	}
+
 	return update(_dataSize + value.size());
 }
 
 
+MutableMemoryView
+PartialDataWriter::reserve(size_type maxBytes, size_type maxMessageSize) {
+	auto view = reserveSpace(_writer, maxBytes, maxMessageSize);
+	_reserved = narrow_cast<size_type>(view.size());
+
+	return view;
+}
+
+
+styxe::Result<void>
+PartialDataWriter::commit(size_type dataSize) {
+	if (dataSize > _reserved) {
+		return getCannedError(CannedError::NotEnoughSpace);
+	}
+
+	_writer.encoder().buffer().advance(dataSize);
+	_reserved = 0;
+	_dataSize += dataSize;
+
+	if (!_writer.isSizeUpdateDeferred()) {
+		patchCounter(_writer.encoder(), _segmentsPos, _dataSize);
+		_writer.updateMessageSize();
+	}
+
+	return Ok();
+}
+
+
+MessageWriterBase&
+PartialDataWriter::finish() {
+	patchCounter(_writer.encoder(), _segmentsPos, _dataSize);
+	_writer.finish();
+
+	return _writer;
+}
+
+
 MessageWriterBase&
 PartialStringWriter::string(Solace::StringView value) {
 	auto& buffer = _writer.encoder().buffer();
 
 	_dataSize += value.size();
 	buffer.write(value.view());
-	auto const finalPos = buffer.position();
 
-	buffer.position(_segmentsPos);  // Reset output stream to the start position
-	_writer.encoder() << _dataSize;
-	buffer.position(finalPos);
-	_writer.updateMessageSize();
+	if (!_writer.isSizeUpdateDeferred()) {
+		patchCounter(_writer.encoder(), _segmentsPos, _dataSize);
+		_writer.updateMessageSize();
+	}
+
+	return _writer;
+}
+
+
+MutableMemoryView
+PartialStringWriter::reserve(size_type maxBytes, size_type maxMessageSize) {
+	constexpr size_type kMaxStringSize = std::numeric_limits<StringView::size_type>::max();
+
+	auto view = reserveSpace(_writer, std::min(maxBytes, kMaxStringSize - _dataSize), maxMessageSize);
+	_reserved = narrow_cast<StringView::size_type>(view.size());
+
+	return view;
+}
+
+
+styxe::Result<void>
+PartialStringWriter::commit(size_type stringSize) {
+	if (stringSize > _reserved) {
+		return getCannedError(CannedError::NotEnoughSpace);
+	}
+
+	_writer.encoder().buffer().advance(stringSize);
+	_reserved = 0;
+	_dataSize += narrow_cast<StringView::size_type>(stringSize);
+
+	if (!_writer.isSizeUpdateDeferred()) {
+		patchCounter(_writer.encoder(), _segmentsPos, _dataSize);
+		_writer.updateMessageSize();
+	}
+
+	return Ok();
+}
+
+
+MessageWriterBase&
+PartialStringWriter::finish() {
+	patchCounter(_writer.encoder(), _segmentsPos, _dataSize);
+	_writer.finish();
 
 	return _writer;
 }
@@ -115,9 +246,8 @@ PartialStringWriter::string(Solace::StringView value) {
 RequestWriter&
 PathDataWriter::data(Solace::MemoryView value) {
 	_writer.encoder() << value;
-	_writer.updateMessageSize();
 
-	return _writer;
+	return finish();
 }
 
 
@@ -19,25 +19,158 @@
 
 #include "styxe/errorDomain.hpp"
 #include "styxe/decoder.hpp"
+#include "styxe/9p2000.hpp"  // OpenMode, MessageSchema
 
 #include <solace/byteReader.hpp>
 #include <solace/result.hpp>
 
+#include <tuple>
+#include <type_traits>
+#include <utility>  // std::index_sequence
+
 namespace styxe {
 
+namespace detail {
+
+/// Type of a value without reference and cv-qualifiers. Unlike std::decay, arrays are kept as is.
+template<typename T>
+using BareType = std::remove_cv_t<std::remove_reference_t<T>>;
+
+
+/// Number of leading values of fixed size.
+template<typename...Args>
+constexpr std::size_t fixedPrefixLength() noexcept {
+	constexpr bool isFixed[] = {(FixedWireSize<BareType<Args>>::value != 0)..., false};
+
+	std::size_t length = 0;
+	while (isFixed[length]) {
+		++length;
+	}
+
+	return length;
+}
+
+
+/// Size in bytes of the given values in the wire format.
+template<typename Tuple, std::size_t...I>
+constexpr size_type fixedSizeOf(std::index_sequence<I...>) noexcept {
+	return (size_type{0} + ... + FixedWireSize<BareType<std::tuple_element_t<I, Tuple>>>::value);
+}
+
+
+template<std::size_t Offset, std::size_t...I>
+constexpr std::index_sequence<(Offset + I)...> offsetIndices(std::index_sequence<I...>) noexcept { return {}; }
+
+
+/**
+ * Load a little-endian integer without bounds checking.
+ * Byte-wise assembly is portable and compiles to a single load on little-endian targets.
+ */
+template<typename T>
+inline void loadLE(Solace::byte const* src, T& dest) noexcept {
+	T value = 0;
+	for (std::size_t i = 0; i < sizeof(T); ++i) {
+		value |= static_cast<T>(static_cast<T>(src[i]) << (8 * i));
+	}
+
+	dest = value;
+}
+
+inline void loadLE(Solace::byte const* src, Qid& dest) noexcept {
+	loadLE(src, dest.type);
+	loadLE(src + sizeof(Qid::type), dest.version);
+	loadLE(src + sizeof(Qid::type) + sizeof(Qid::version), dest.path);
+}
+
+inline void loadLE(Solace::byte const* src, OpenMode& dest) noexcept {
+	loadLE(src, dest.mode);
+}
+
+template<typename T, std::size_t N>
+inline void loadLE(Solace::byte const* src, T (&dest)[N]) noexcept {
+	for (auto& value : dest) {
+		loadLE(src, value);
+		src += FixedWireSize<T>::value;
+	}
+}
+
+
+/// Load fixed size values without bounds checking. Caller must check that the source holds all of the values.
+template<typename Tuple, std::size_t...I>
+inline void loadFixedPrefix(Solace::byte const* src, Tuple& fields, std::index_sequence<I...>) noexcept {
+	((loadLE(src, std::get<I>(fields)), src += FixedWireSize<BareType<std::tuple_element_t<I, Tuple>>>::value), ...);
+}
+
+
+/// Decode values of variable length with bounds checking.
+template<typename Tuple, std::size_t...I>
+Solace::Result<Solace::ByteReader&, Error>
+decodeTail(Solace::ByteReader& data, Tuple& fields, std::index_sequence<I...>) {
+	if constexpr (sizeof...(I) != 0) {
+		Decoder decoder{data};
+		auto result = (decoder >> ... >> std::get<I>(fields));
+		if (!result) return result.moveError();
+	}
+
+	return Solace::Result<Solace::ByteReader&, Error>{Solace::types::okTag, data};
+}
+
+}  // namespace detail
+
+
 Solace::Result<Solace::ByteReader&, Error>
 inline decode(Solace::ByteReader& data) noexcept {
 	return Solace::Result<Solace::ByteReader&, Error>{Solace::types::okTag, data};
 }
 
+/**
+ * Decode message fields from the data.
+ * Leading fields of fixed size are checked against the data size once and loaded without further checks.
+ * Only the variable length tail, if any, is decoded field by field.
+ */
 template<typename...Args>
 Solace::Result<Solace::ByteReader&, Error>
 decode(Solace::ByteReader& data, Args&& ...args) {
-	Decoder decoder{data};
-	auto result = (decoder >> ... >> args);
-	if (!result) return result.moveError();
+	using Fields = std::tuple<Args&...>;
+	constexpr auto kPrefixLength = detail::fixedPrefixLength<Args...>();
+	constexpr auto kPrefixSize = detail::fixedSizeOf<Fields>(std::make_index_sequence<kPrefixLength>{});
 
-	return Solace::Result<Solace::ByteReader&, Error>{Solace::types::okTag, data};
+	Fields fields{args...};
+	if constexpr (kPrefixLength != 0) {
+		if (data.remaining() < kPrefixSize) {
+			return getCannedError(CannedError::NotEnoughData);
+		}
+
+		detail::loadFixedPrefix(data.viewRemaining().dataAddress(), fields, std::make_index_sequence<kPrefixLength>{});
+		data.position(data.position() + kPrefixSize);
+	}
+
+	return detail::decodeTail(data, fields,
+							  detail::offsetIndices<kPrefixLength>(
+								  std::make_index_sequence<sizeof...(Args) - kPrefixLength>{}));
+}
+
+
+namespace detail {
+
+template<typename MessageType, std::size_t...I>
+Solace::Result<Solace::ByteReader&, Error>
+decodeMessage(Solace::ByteReader& data, MessageType& dest, std::index_sequence<I...>) {
+	using Schema = MessageSchema<MessageType>;
+	return decode(data, (dest.*(std::get<I>(Schema::fields).member))...);
+}
+
+}  // namespace detail
+
+
+/**
+ * Decode a message from the data, field by field, as described by the message schema.
+ * @see MessageSchema
+ */
+template<typename MessageType>
+Solace::Result<Solace::ByteReader&, Error>
+decodeMessage(Solace::ByteReader& data, MessageType& dest) {
+	return detail::decodeMessage(data, dest, detail::FieldIndices<MessageType>{});
 }
 
 }  // namespace styxe
@@ -0,0 +1,56 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/payloadAlignment.hpp"
+
+#include <cstdint>  // std::uintptr_t
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+size_type
+styxe::alignedFrameOffset(void const* bufferStart, size_type payloadOffset, size_type alignment) noexcept {
+	auto const payloadAddress = reinterpret_cast<std::uintptr_t>(bufferStart) + payloadOffset;
+	auto const misalignment = static_cast<size_type>(payloadAddress & (alignment - 1));
+
+	return (alignment - misalignment) & (alignment - 1);
+}
+
+
+styxe::Result<MutableMemoryView>
+styxe::alignPayload(MutableMemoryView buffer, size_type payloadOffset, size_type alignment) {
+	auto const frameOffset = alignedFrameOffset(buffer.dataAddress(), payloadOffset, alignment);
+	if (frameOffset + payloadOffset > buffer.size()) {
+		return getCannedError(CannedError::NotEnoughSpace);
+	}
+
+	return Ok(buffer.slice(frameOffset, buffer.size()));
+}
+
+
+styxe::Result<MutableMemoryView>
+styxe::alignReceivedPayload(MutableMemoryView buffer, MessageHeader const& header, size_type alignment) {
+	auto const offset = payloadOffset(header.type);
+	auto const frameOffset = (offset != 0) ? alignedFrameOffset(buffer.dataAddress(), offset, alignment) : 0;
+	auto const bodyOffset = frameOffset + headerSize();
+	if (bodyOffset + header.payloadSize() > buffer.size()) {
+		return getCannedError(CannedError::NotEnoughSpace);
+	}
+
+	return Ok(buffer.slice(bodyOffset, bodyOffset + header.payloadSize()));
+}
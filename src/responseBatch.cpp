@@ -0,0 +1,120 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/responseBatch.hpp"
+
+#include <algorithm>  // std::min
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+ResponseBatch::ResponseBatch(MutableMemoryView buffer, size_type maxBytes, size_type maxMessages) noexcept
+	: _buffer{buffer}
+	, _maxBytes{maxBytes}
+	, _maxMessages{std::min(maxMessages, kMaxMessages)}
+{
+}
+
+
+ResponseBatch::MessageBoundary const&
+ResponseBatch::message(size_type index) const {
+	assertIndexInRange(index, _nMessages, "ResponseBatch::message");
+
+	return _messages[index];
+}
+
+
+size_type
+ResponseBatch::messagesSent() const noexcept {
+	size_type count = 0;
+	while (count < _nMessages && _messages[count].offset + _messages[count].size <= _nBytesSent) {
+		++count;
+	}
+
+	return count;
+}
+
+
+void
+ResponseBatch::acknowledge(size_type nBytes) noexcept {
+	nBytes = std::min(nBytes, _nBytes - _nBytesSent);
+	_nBytesSent += nBytes;
+	if (_nBytesSent == _nBytes) {
+		clear();
+		return;
+	}
+
+	while (nBytes > 0) {
+		auto& vec = _ioVecs[_firstIoVec];
+		if (nBytes < vec.iov_len) {
+			vec.iov_base = static_cast<byte*>(vec.iov_base) + nBytes;
+			vec.iov_len -= nBytes;
+			break;
+		}
+
+		nBytes -= narrow_cast<size_type>(vec.iov_len);
+		_firstIoVec += 1;
+	}
+}
+
+
+void
+ResponseBatch::clear() noexcept {
+	_buffer.rewind();
+	_nBytes = 0;
+	_nBytesSent = 0;
+	_nMessages = 0;
+	_nIoVecs = 0;
+	_firstIoVec = 0;
+}
+
+
+bool
+ResponseBatch::commit(ByteWriter::size_type startPos, MessageHeader header, MemoryView payload) {
+	auto const written = _buffer.position() - startPos;
+	if (written + payload.size() != header.messageSize) {  // Output buffer overflow, message is incomplete
+		_buffer.position(startPos);
+		return false;
+	}
+
+	_messages[_nMessages] = MessageBoundary{header.tag, _nBytes, header.messageSize};
+	_nMessages += 1;
+	_nBytes += header.messageSize;
+
+	addIoVec(_buffer.viewWritten().slice(startPos, _buffer.position()));
+	if (!payload.empty()) {
+		addIoVec(payload);
+	}
+
+	return true;
+}
+
+
+void
+ResponseBatch::addIoVec(MemoryView data) noexcept {
+	if (_nIoVecs > 0) {
+		auto& last = _ioVecs[_nIoVecs - 1];
+		if (static_cast<byte const*>(last.iov_base) + last.iov_len == data.dataAddress()) {
+			last.iov_len += data.size();
+			return;
+		}
+	}
+
+	_ioVecs[_nIoVecs] = iovec{const_cast<byte*>(data.dataAddress()), data.size()};
+	_nIoVecs += 1;
+}
@@ -0,0 +1,86 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/tagAllocator.hpp"
+
+#include <algorithm>  // std::min
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+/// Marks the end of the free list. Same value as kNoTag, which is never allocated.
+constexpr Tag kEndOfList = std::numeric_limits<Tag>::max();
+
+constexpr uint64 kTagMask = 0xFFFFFFFF;
+
+constexpr Tag tagOf(uint64 head) noexcept {
+	return static_cast<Tag>(head & kTagMask);
+}
+
+constexpr uint64 nextHead(uint64 head, Tag tag) noexcept {
+	return ((head & ~kTagMask) + (kTagMask + 1)) | tag;
+}
+
+}  // namespace
+
+
+TagAllocator::TagAllocator(size_type capacity)
+	: _next(std::min(capacity, kMaxTags))
+	, _head{_next.empty() ? kEndOfList : Tag{0}}
+{
+	auto const nTags = _next.size();
+	for (std::size_t i = 0; i < nTags; ++i) {
+		_next[i].store(static_cast<Tag>(i + 1 < nTags ? i + 1 : kEndOfList), std::memory_order_relaxed);
+	}
+}
+
+
+styxe::Result<Tag>
+TagAllocator::acquire() {
+	auto head = _head.load(std::memory_order_acquire);
+	uint64 newHead;
+	do {
+		auto const tag = tagOf(head);
+		if (tag == kEndOfList) {
+			return getCannedError(CannedError::TagsExhausted);
+		}
+
+		// Next of a tag is stale if another thread takes the tag first: the update counter then fails the exchange.
+		newHead = nextHead(head, _next[tag].load(std::memory_order_relaxed));
+	} while (!_head.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire));
+
+	_inFlight.fetch_add(1, std::memory_order_relaxed);
+
+	return Ok(tagOf(head));
+}
+
+
+void
+TagAllocator::release(Tag tag) {
+	assertIndexInRange(static_cast<size_type>(tag), capacity(), "TagAllocator::release");
+
+	_inFlight.fetch_sub(1, std::memory_order_relaxed);
+
+	auto head = _head.load(std::memory_order_relaxed);
+	do {
+		_next[tag].store(tagOf(head), std::memory_order_relaxed);
+	} while (!_head.compare_exchange_weak(head, nextHead(head, tag),
+										  std::memory_order_release, std::memory_order_relaxed));
+}
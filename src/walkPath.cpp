@@ -0,0 +1,163 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/decoder.hpp"
+#include "styxe/errorDomain.hpp"
+
+#include <solace/assert.hpp>
+
+#include <cstring>  // std::memcpy
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace {
+
+/// Check if a word has a zero byte.
+constexpr bool hasZeroByte(uint64 word) noexcept {
+	return ((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) != 0;
+}
+
+
+/**
+ * Check if a path segment has bytes not allowed in a file name: '/' or NUL.
+ * Segment is scanned a word at a time, checking 8 bytes per step.
+ */
+bool hasIllegalBytes(MemoryView segment) noexcept {
+	constexpr uint64 kSlashes = 0x0101010101010101ULL * '/';
+
+	auto p = segment.begin();
+	auto n = segment.size();
+	for (; n >= sizeof(uint64); p += sizeof(uint64), n -= sizeof(uint64)) {
+		uint64 word;
+		std::memcpy(&word, p, sizeof(word));
+		if (hasZeroByte(word) || hasZeroByte(word ^ kSlashes)) {
+			return true;
+		}
+	}
+
+	for (; n > 0; ++p, --n) {
+		if (*p == 0 || *p == '/') {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+bool isParentSegment(MemoryView segment) noexcept {
+	return segment.size() == 2 && segment[0] == '.' && segment[1] == '.';
+}
+
+
+/**
+ * Scan path segments in a single pass.
+ * Each segment is checked to be within the bounds of the data and to be a valid file name.
+ * @param data Encoded path segments.
+ * @param count Number of segments.
+ * @param onSegment A callback invoked with segment index, offset of its length prefix and segment data.
+ * @return Number of bytes taken by the path segments or an error.
+ */
+template<typename F>
+Solace::Result<uint32, Error>
+scanPathSegments(MemoryView data, WalkPath::size_type count, F&& onSegment) {
+	ByteReader reader{data};
+	for (WalkPath::size_type i = 0; i < count; ++i) {
+		auto const offset = narrow_cast<uint32>(reader.position());
+
+		var_datum_size_type segmentSize = 0;
+		auto result = reader.readLE(segmentSize);
+		if (!result) return result.moveError();
+
+		if (reader.remaining() < segmentSize) {
+			return getCannedError(CannedError::NotEnoughData);
+		}
+
+		auto const segment = reader.viewRemaining().slice(0, segmentSize);
+		if (hasIllegalBytes(segment)) {
+			return getCannedError(CannedError::IllFormedWalkPath);
+		}
+
+		onSegment(i, offset, segment);
+		reader.position(reader.position() + segmentSize);
+	}
+
+	return Ok(narrow_cast<uint32>(reader.position()));
+}
+
+}  // namespace
+
+
+Solace::Result<Decoder&, Error>
+styxe::operator>> (Decoder& decoder, WalkPath& path) {
+	auto& buffer = decoder.buffer();
+	WalkPath::size_type componentsCount = 0;
+
+	auto result = buffer.readLE(componentsCount);
+	if (!result) return result.moveError();
+
+	auto const data = buffer.viewRemaining();
+	auto pathSize = scanPathSegments(data, componentsCount, [](WalkPath::size_type, uint32, MemoryView) {});
+	if (!pathSize) return pathSize.moveError();
+
+	path = WalkPath{componentsCount, data.slice(0, *pathSize)};
+	buffer.position(buffer.position() + *pathSize);
+
+	return Solace::Result<Decoder&, Error>{types::okTag, decoder};
+}
+
+
+Solace::Result<Decoder&, Error>
+styxe::operator>> (Decoder& decoder, WalkPathIndex& dest) {
+	auto& buffer = decoder.buffer();
+	WalkPath::size_type componentsCount = 0;
+
+	auto result = buffer.readLE(componentsCount);
+	if (!result) return result.moveError();
+
+	if (componentsCount > WalkPathIndex::kMaxSegments) {
+		return getCannedError(CannedError::IllFormedWalkPath_TooLong);
+	}
+
+	WalkPathIndex index;
+	auto const data = buffer.viewRemaining();
+	auto pathSize = scanPathSegments(data, componentsCount,
+									 [&index](WalkPath::size_type i, uint32 offset, MemoryView segment) {
+		index._offsets[i] = offset;
+		index._hasParentSegments |= isParentSegment(segment);
+	});
+	if (!pathSize) return pathSize.moveError();
+
+	index._offsets[componentsCount] = *pathSize;
+	index._size = componentsCount;
+	index._data = data.slice(0, *pathSize);
+	dest = index;
+	buffer.position(buffer.position() + *pathSize);
+
+	return Solace::Result<Decoder&, Error>{types::okTag, decoder};
+}
+
+
+StringView
+WalkPathIndex::operator[] (size_type index) const {
+	assertIndexInRange(index, size_type{0}, _size, "WalkPathIndex[]");
+
+	auto const segment = _data.slice(_offsets[index] + sizeof(var_datum_size_type), _offsets[index + 1]);
+	return StringView{reinterpret_cast<char const*>(segment.begin()), narrow_cast<StringView::size_type>(segment.size())};
+}
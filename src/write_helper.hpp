@@ -18,31 +18,54 @@
 #define STYXE_INTERNAL_WRITE_HELPER_HPP
 
 #include "styxe/messageWriter.hpp"
+#include "styxe/messageSchema.hpp"
 
 
 namespace styxe {
 
-template<typename MsgType, typename...Args>
-RequestWriter&
-encode(RequestWriter& writer, MsgType const&, Args&& ...args) {
-	(writer.messageTypeOf<MsgType>()
-			<< ... << args);
-	writer.updateMessageSize();
+namespace detail {
 
-	return writer;
+template<typename T>
+void encodeField(Encoder& encoder, T const& value) {
+	encoder << value;
+}
+
+template<typename T, std::size_t N>
+void encodeField(Encoder& encoder, T const (&value)[N]) {
+	for (auto const& item : value) {
+		encoder << item;
+	}
 }
 
+}  // namespace detail
 
-template<typename MsgType, typename...Args>
-ResponseWriter&
-encode(ResponseWriter& writer, MsgType const&, Args&& ...args) {
-	(writer.messageTypeOf<MsgType>()
-			<< ... << args);
-	writer.updateMessageSize();
 
-	return writer;
+/// Overwrite a counter written at a given position of the output stream.
+template<typename T>
+void patchCounter(Encoder& encoder, Solace::ByteWriter::size_type counterPos, T value) {
+	auto& buffer = encoder.buffer();
+	auto const finalPos = buffer.position();
+	buffer.position(counterPos);  // Reset output stream to the start position
+	encoder << value;
+	buffer.position(finalPos);  // Reset output stream to the final position
 }
 
 
+/**
+ * Encode a message into a writer, field by field, as described by the message schema.
+ * Message size is computed from the schema upfront, so the header is written once and never re-written.
+ * @see MessageSchema
+ */
+template<typename MessageTag, typename MsgType>
+MessageWriter<MessageTag>&
+encodeMessage(MessageWriter<MessageTag>& writer, MsgType const& message) {
+	auto& encoder = writer.template messageTypeOf<MsgType>(protocolSize(message));
+	forEachField(message, [&encoder](char const*, auto const& value) {
+		detail::encodeField(encoder, value);
+	});
+
+	return writer;
+}
+
 }  // namespace styxe
 #endif  // STYXE_INTERNAL_WRITE_HELPER_HPP
@@ -474,6 +474,61 @@ TEST_F(P9Messages, createPartialReadResponse) {
 }
 
 
+TEST_F(P9Messages, createPartialReadResponseWithDeferredSizeUpdates) {
+	char const content1[] = {'h', 'e', 'l', 'l', 'o'};
+	char const content2[] = {'c', 'o', 'n', 't', 'e', 'n', 't'};
+
+	ResponseWriter writer{_writer, 1};
+	writer.deferSizeUpdates();
+	(writer << Response::Partial::Read{}
+			<< wrapMemory(content1)
+			<< wrapMemory(content2))
+			.finish();
+
+	getResponseOrFail<Response::Read>()
+			.then([&](Response::Read&& response) {
+				ASSERT_EQ(sizeof(content1) + sizeof(content2), response.data.size());
+				ASSERT_EQ(wrapMemory(content1), response.data.slice(0, sizeof(content1)));
+			});
+}
+
+
+TEST_F(P9Messages, createReadResponseWithDataWrittenInPlace) {
+	char const content[] = "file content read directly into the message";
+
+	ResponseWriter writer{_writer, 1};
+	auto dataWriter = writer << Response::Partial::Read{};
+
+	// Reservation is capped by the message size limit, not by the requested count.
+	auto constexpr kMaxMessageSize = 64;
+	auto view = dataWriter.reserve(4096, kMaxMessageSize);
+	ASSERT_EQ(kMaxMessageSize - headerSize() - sizeof(size_type), view.size());
+
+	memcpy(view.dataAddress(), content, 10);  // pread(fd, view.dataAddress(), view.size(), offset)
+	ASSERT_TRUE(dataWriter.commit(10).isOk());
+	ASSERT_TRUE(dataWriter.commit(1).isError());  // Nothing reserved any more
+
+	getResponseOrFail<Response::Read>()
+			.then([&](Response::Read&& response) {
+				ASSERT_EQ(wrapMemory(content, 10), response.data);
+			});
+}
+
+
+TEST_F(P9Messages, readReservationIsCappedByCountAndBuffer) {
+	byte buffer[headerSize() + sizeof(size_type) + 16];
+	ByteWriter dest{wrapMemory(buffer)};
+
+	ResponseWriter writer{dest, 1};
+	auto dataWriter = writer << Response::Partial::Read{};
+	ASSERT_EQ(8U, dataWriter.reserve(8, kMaxMessageSize).size());
+	ASSERT_EQ(16U, dataWriter.reserve(4096, kMaxMessageSize).size());
+	ASSERT_TRUE(dataWriter.commit(17).isError());
+	ASSERT_TRUE(dataWriter.commit(16).isOk());
+	ASSERT_EQ(0U, dataWriter.reserve(4096, kMaxMessageSize).size());
+}
+
+
 TEST_F(P9Messages, parseReadResponse) {
 	auto const messageText = StringLiteral{"This is a very important data d-_^b"};
 	auto const messageData = messageText.view();
@@ -744,6 +799,69 @@ TEST_F(P9Messages, createPartialWalkRequest) {
 }
 
 
+TEST_F(P9Messages, createPartialWalkRequestWithDeferredSizeUpdates) {
+	RequestWriter writer{_writer};
+	writer.deferSizeUpdates();
+
+	auto pathWriter = writer << Request::Partial::Walk{213, 124};
+	pathWriter.segment("space");
+	pathWriter.segment("knowhere");
+
+	// Nothing is back-patched until the message is finished
+	EXPECT_EQ(headerSize(), writer.header().messageSize);
+	pathWriter.finish();
+
+	getRequestOrFail<Request::Walk>()
+			.then([](Request::Walk&& request) {
+				EXPECT_EQ(213U, request.fid);
+				EXPECT_EQ(124U, request.newfid);
+				EXPECT_EQ(2U, request.path.size());
+				EXPECT_EQ("space", *request.path.begin());
+			});
+}
+
+
+TEST_F(P9Messages, walkRequestToParentDirectory) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{".."}
+		   << StringView{"..."};
+
+	getRequestOrFail<Request::Walk>()
+			.then([](Request::Walk&& request) {
+				EXPECT_EQ(2U, request.path.size());
+				EXPECT_EQ("..", *request.path.begin());
+			});
+}
+
+
+TEST_F(P9Messages, walkRequestWithSlashInPathIsRejected) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{"space"}
+		   << StringView{"long-segment/name"};
+
+	ByteReader reader{_writer.viewWritten()};
+	ASSERT_TRUE(parseMessageHeader(reader).isOk());
+
+	Request::Walk request;
+	EXPECT_TRUE((reader >> request).isError());
+}
+
+
+TEST_F(P9Messages, walkRequestWithNulInPathIsRejected) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{"long-segment\0name", 17};
+
+	ByteReader reader{_writer.viewWritten()};
+	ASSERT_TRUE(parseMessageHeader(reader).isOk());
+
+	Request::Walk request;
+	EXPECT_TRUE((reader >> request).isError());
+}
+
+
 TEST_F(P9Messages, createWalkEmptyPathRequest) {
 	RequestWriter writer{_writer};
 	writer << Request::Walk{7374, 542, WalkPath(0, MemoryView{})};
@@ -758,19 +876,88 @@ TEST_F(P9Messages, createWalkEmptyPathRequest) {
 
 
 TEST_F(P9Messages, createWalkResponse) {
-	Response::Walk message;
-	message.nqids = 3;
-	message.qids[2].path = 21;
-	message.qids[2].version = 117;
-	message.qids[2].type = 81;
+	auto const qid = Qid{21, 117, 81};
+
+	ResponseWriter writer{_writer, 1};
+	writer << Response::Partial::Walk{}
+		   << randomQid()
+		   << randomQid()
+		   << qid;
+
+	getResponseOrFail<Response::Walk>()
+			.then([&](Response::Walk&& response) {
+				ASSERT_EQ(3U, response.qids.size());
+				ASSERT_EQ(qid, response.qids[2]);
+            });
+}
+
+
+TEST_F(P9Messages, createWalkResponseWithMoreThan16Qids) {
+	ResponseWriter writer{_writer, 1};
+	auto qidWriter = writer << Response::Partial::Walk{};
+	for (uint64 i = 0; i < 32; ++i) {
+		qidWriter << Qid{i, 1, 0};
+	}
+
+	getResponseOrFail<Response::Walk>()
+			.then([](Response::Walk&& response) {
+				ASSERT_EQ(32U, response.qids.size());
+
+				uint64 expectedPath = 0;
+				for (auto qid : response.qids) {
+					EXPECT_EQ(expectedPath++, qid.path);
+				}
+            });
+}
+
+
+TEST_F(P9Messages, createWalkResponseWithDeferredSizeUpdates) {
+	auto const qid = randomQid();
+
+	ResponseWriter writer{_writer, 1};
+	writer.deferSizeUpdates();
+	(writer << Response::Partial::Walk{}
+			<< randomQid()
+			<< qid)
+			.finish();
+
+	getResponseOrFail<Response::Walk>()
+			.then([&](Response::Walk&& response) {
+				ASSERT_EQ(2U, response.qids.size());
+				ASSERT_EQ(qid, response.qids[1]);
+            });
+}
+
+
+TEST_F(P9Messages, messageOfKnownSizeIsWrittenOnce) {
+	ResponseWriter writer{_writer, 1};
+	writer.deferSizeUpdates();
+	writer << Response::Open{randomQid(), 4096};
+
+	// Size of the message is known upfront, thus no finish() is required
+	EXPECT_EQ(headerSize() + 13 + 4, writer.header().messageSize);
+	getResponseOrFail<Response::Open>()
+			.then([](Response::Open&& response) {
+				EXPECT_EQ(4096U, response.iounit);
+            });
+}
+
+
+TEST_F(P9Messages, createWalkResponseFromEncodedQids) {
+	auto const qid = randomQid();
+
+	byte qidsBuffer[QidSpan::kQidSize];
+	ByteWriter qidsWriter{wrapMemory(qidsBuffer)};
+	styxe::Encoder encoder{qidsWriter};
+	encoder << qid;
 
 	ResponseWriter writer{_writer, 1};
-	writer << message;
+	writer << Response::Walk{QidSpan{1, qidsWriter.viewWritten()}};
 
 	getResponseOrFail<Response::Walk>()
 			.then([&](Response::Walk&& response) {
-				ASSERT_EQ(message.nqids, response.nqids);
-				ASSERT_EQ(message.qids[2], response.qids[2]);
+				ASSERT_EQ(1U, response.qids.size());
+				ASSERT_EQ(qid, response.qids[0]);
             });
 }
 
@@ -789,7 +976,7 @@ TEST_F(P9Messages, parseWalkResponse) {
 
 	getResponseOrFail<Response::Walk>()
             .then([](Response::Walk&& response) {
-				EXPECT_EQ(1U, response.nqids);
+				EXPECT_EQ(1U, response.qids.size());
 				EXPECT_EQ(17, response.qids[0].type);
 				EXPECT_EQ(5481U, response.qids[0].version);
 				EXPECT_EQ(87U, response.qids[0].path);
@@ -526,6 +526,24 @@ TEST_F(P92000L_Responses, readLink) {
 }
 
 
+TEST_F(P92000L_Responses, readLinkWrittenInPlace) {
+	char const target[] = "/some/link/target";
+
+	ResponseWriter writer{_writer, 3};
+	auto stringWriter = writer << _9P2000L::Response::Partial::ReadLink{};
+	auto view = stringWriter.reserve(4096, kMaxMessageSize);
+	ASSERT_LE(sizeof(target), view.size());
+
+	memcpy(view.dataAddress(), target, sizeof(target) - 1);  // readlink(path, view.dataAddress(), view.size())
+	ASSERT_TRUE(stringWriter.commit(sizeof(target) - 1).isOk());
+
+	getResponseOrFail<_9P2000L::Response::ReadLink>()
+			.then([&] (_9P2000L::Response::ReadLink const& response) {
+				ASSERT_EQ(StringView{target}, response.target);
+			});
+}
+
+
 TEST_F(P92000L_Responses, getAttr) {
 	auto qid = randomQid();
 	ResponseWriter writer{_writer, 3};
@@ -638,6 +656,28 @@ TEST_F(P92000L_Responses, readDir) {
 }
 
 
+TEST_F(P92000L_Responses, readDirWrittenInPlace) {
+	_9P2000L::DirEntry const entry{randomQid(), 0, 31, StringView{"Awesome file"}};
+
+	ResponseWriter writer{_writer, 3};
+	auto dataWriter = writer << _9P2000L::Response::Partial::ReadDir{};
+	auto view = dataWriter.reserve(protocolSize(entry), kMaxMessageSize);
+	ASSERT_EQ(protocolSize(entry), view.size());
+
+	ByteWriter entryWriter{view};
+	styxe::Encoder encoder{entryWriter};
+	encoder << entry;
+	ASSERT_TRUE(dataWriter.commit(narrow_cast<size_type>(entryWriter.position())).isOk());
+
+	getResponseOrFail<_9P2000L::Response::ReadDir>()
+			.then([&entry] (_9P2000L::Response::ReadDir const& response) {
+				_9P2000L::DirEntryReader reader{response.data};
+				ASSERT_NE(begin(reader), end(reader));
+				ASSERT_EQ(entry, *begin(reader));
+			});
+}
+
+
 TEST_F(P92000L_Responses, fSync) {
 	ResponseWriter writer{_writer, 3};
 	writer << _9P2000L::Response::FSync{};
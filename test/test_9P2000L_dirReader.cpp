@@ -19,6 +19,7 @@
  * Specific test 9P2000.e
  *******************************************************************************/
 #include "styxe/9p2000L.hpp"
+#include "styxe/messageParser.hpp"
 
 #include "testHarnes.hpp"
 
@@ -141,3 +142,94 @@ TEST(P92000L, dirReader_incomplete_buffer_2) {
 
 	ASSERT_EQ(2U, index);
 }
+
+
+namespace  {
+
+/// Parse Rreaddir response written into a buffer.
+_9P2000L::Response::ReadDir parseReadDir(ByteWriter& buffer) {
+	ByteReader reader{buffer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	EXPECT_TRUE(header.isOk());
+	EXPECT_EQ(asByte(_9P2000L::MessageType::Rreaddir), header->type);
+	EXPECT_EQ(buffer.position(), header->messageSize);
+
+	_9P2000L::Response::ReadDir response;
+	EXPECT_TRUE((reader >> response).isOk());
+
+	return response;
+}
+
+}  // namespace
+
+
+TEST(P92000L, readDirWriterStopsAtCountBudget) {
+	_9P2000L::DirEntry const entries[] = {
+		{randomQid(), 1, 31, StringView{"data"}},
+		{randomQid(), 2, 31, StringView{"Awesome file"}},
+		{randomQid(), 3, 32, StringView{"other file"}}
+	};
+
+	byte buffer[127];
+	ByteWriter dest{wrapMemory(buffer)};
+	ResponseWriter writer{dest, 1};
+	auto const count = narrow_cast<uint32>(protocolSize(entries[0]) + protocolSize(entries[1]) + 5);
+	_9P2000L::ReadDirWriter dirWriter{writer, count, 0};
+
+	int generated = 0;
+	auto const nextOffset = dirWriter.fill([&](_9P2000L::DirEntry& entry) {
+		if (generated == 3)
+			return false;
+
+		entry = entries[generated++];
+		return true;
+	});
+
+	EXPECT_EQ(3, generated);  // Last entry is generated but left for the next read
+	EXPECT_EQ(2U, dirWriter.size());
+	EXPECT_EQ(2U, nextOffset);
+	EXPECT_EQ(count - 5, dirWriter.bytesEncoded());
+
+	auto const response = parseReadDir(dest);
+	ASSERT_EQ(dirWriter.bytesEncoded(), response.data.size());
+
+	_9P2000L::DirEntryReader reader{response.data};
+	size_t index = 0;
+	for (auto const& ent : reader) {
+		ASSERT_EQ(entries[index], ent);
+		index += 1;
+	}
+	ASSERT_EQ(2U, index);
+}
+
+
+TEST(P92000L, readDirWriterOfEmptyDirectory) {
+	byte buffer[127];
+	ByteWriter dest{wrapMemory(buffer)};
+	ResponseWriter writer{dest, 1};
+	_9P2000L::ReadDirWriter dirWriter{writer, 4096, 42};
+
+	auto const nextOffset = dirWriter.fill([](_9P2000L::DirEntry&) { return false; });
+	EXPECT_EQ(42U, nextOffset);
+	EXPECT_EQ(0U, dirWriter.size());
+
+	auto const response = parseReadDir(dest);
+	ASSERT_TRUE(response.data.empty());
+}
+
+
+TEST(P92000L, readDirWriterDoesNotOverflowOutputBuffer) {
+	_9P2000L::DirEntry const entry{randomQid(), 1, 31, StringView{"Awesome file"}};
+
+	byte buffer[headerSize() + sizeof(size_type) + 40];
+	ByteWriter dest{wrapMemory(buffer)};
+	ResponseWriter writer{dest, 1};
+	_9P2000L::ReadDirWriter dirWriter{writer, 4096};
+
+	EXPECT_TRUE(dirWriter.encode(entry));
+	EXPECT_FALSE(dirWriter.encode(entry));
+	dirWriter.finish();
+
+	auto const response = parseReadDir(dest);
+	ASSERT_EQ(protocolSize(entry), response.data.size());
+}
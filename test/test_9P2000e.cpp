@@ -225,6 +225,22 @@ TEST_F(P92000e_Responses, createShortReadResponse) {
 }
 
 
+TEST_F(P92000e_Responses, createShortReadResponseWrittenInPlace) {
+	char const messageData[] = "This was somewhat important data d^_-b";
+
+	auto dataWriter = _responseWriter << _9P2000E::Response::Partial::ShortRead{};
+	auto view = dataWriter.reserve(sizeof(messageData), kMaxMessageSize);
+	ASSERT_EQ(sizeof(messageData), view.size());
+	memcpy(view.dataAddress(), messageData, sizeof(messageData));
+	ASSERT_TRUE(dataWriter.commit(sizeof(messageData)).isOk());
+
+	getResponseOrFail<_9P2000E::Response::ShortRead>()
+			.then([&messageData](_9P2000E::Response::ShortRead&& response) {
+				EXPECT_EQ(wrapMemory(messageData), response.data);
+			});
+}
+
+
 TEST_F(P92000e_Responses, parseShortReadResponse) {
     auto const messageData = StringLiteral{"This is a very important data d-_^b"};
     auto const dataView = messageData.view();
@@ -265,6 +281,31 @@ TEST_F(P92000e_Requests, createShortWriteRequest) {
 }
 
 
+TEST_F(P92000e_Requests, createShortWriteRequestWithOversizedPathBuffer) {
+	char const messageData[] = "This is a very important data d-_^b";
+	auto data = wrapMemory(messageData);
+
+	byte buffer[32] = {};
+	ByteWriter pathWriter{wrapMemory(buffer)};
+	styxe::Encoder encoder{pathWriter};
+	encoder << StringView{"some"}
+			<< StringView{"place"};
+
+	_requestWriter << _9P2000E::Request::ShortWrite{32, WalkPath{2, wrapMemory(buffer)}, data};
+	EXPECT_EQ(headerSize() + sizeof(Fid) + sizeof(WalkPath::size_type) + 2*2 + 4 + 5 +
+			  sizeof(size_type) + data.size(),
+			  _writer.position());
+
+	getRequestOrFail<_9P2000E::Request::ShortWrite>()
+		.then([data](_9P2000E::Request::ShortWrite&& request) {
+			ASSERT_EQ(32U, request.fid);
+			ASSERT_EQ(data, request.data);
+			ASSERT_EQ(2U, request.path.size());
+			ASSERT_EQ("some", *request.path.begin());
+		});
+}
+
+
 TEST_F(P92000e_Requests, createPartialShortWriteRequest) {
 	char const messageData[] = "This is a very important data d-_^b";
 	auto data = wrapMemory(messageData);
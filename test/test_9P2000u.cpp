@@ -272,3 +272,64 @@ TEST_F(P92000u_Responses, parseStatResponse) {
 				ASSERT_EQ(statResponse.data, response.data);
 			});
 }
+
+
+TEST(P92000u, statReaderSkipsRecordsBySize) {
+	_9P2000U::StatEx stats[] = {randomStat(), randomStat(), randomStat()};
+	stats[1].name = "other file";
+	stats[1].extension = "symlink-target";
+	stats[1].size = DirListingWriter::sizeStat(stats[1]);
+
+	byte buffer[512];
+	ByteWriter dest{wrapMemory(buffer)};
+	styxe::Encoder encoder{dest};
+	for (auto const& stat : stats) {
+		encoder << stat;
+	}
+
+	StatReader<_9P2000U::StatEx> reader{dest.viewWritten()};
+	ASSERT_EQ(3U, reader.count());
+
+	size_t index = 0;
+	for (auto i = reader.begin(); i != reader.end(); ++i, ++index) {
+		ASSERT_EQ(protocolSize(stats[index]), i.record().size());
+		auto const maybeStat = *i;
+		ASSERT_TRUE(maybeStat.isOk());
+		auto const& stat = *maybeStat;
+		ASSERT_EQ(stats[index], stat);
+		ASSERT_EQ(stats[index].extension, stat.extension);
+		ASSERT_EQ(stats[index].n_muid, stat.n_muid);
+	}
+	ASSERT_EQ(3U, index);
+
+	// Incomplete trailing record is the last one and is reported as an error
+	StatReader<_9P2000U::StatEx> partialReader{dest.viewWritten().slice(0, dest.position() - 1)};
+	ASSERT_EQ(2U, partialReader.count());
+
+	auto i = partialReader.begin();
+	ASSERT_TRUE((*i).isOk());
+	ASSERT_TRUE((*++i).isOk());
+	ASSERT_NE(partialReader.end(), ++i);
+	ASSERT_TRUE((*i).isError());
+	ASSERT_EQ(partialReader.end(), ++i);
+}
+
+
+TEST(P92000u, statReaderReportsIllFormedRecord) {
+	_9P2000U::StatEx stat = randomStat();
+	stat.size = DirListingWriter::sizeStat(stat);
+
+	byte buffer[512];
+	ByteWriter dest{wrapMemory(buffer)};
+	styxe::Encoder encoder{dest};
+	encoder << stat;
+
+	// Corrupt length of the name: record size prefix is intact, but the name runs past the end of the record.
+	auto const nameOffset = sizeof(var_datum_size_type) + sizeof(stat.type) + sizeof(stat.dev) + 13 +
+			sizeof(stat.mode) + sizeof(stat.atime) + sizeof(stat.mtime) + sizeof(stat.length);
+	buffer[nameOffset] = 0xFF;
+
+	StatReader<_9P2000U::StatEx> reader{dest.viewWritten()};
+	ASSERT_EQ(1U, reader.count());
+	ASSERT_TRUE((*reader.begin()).isError());
+}
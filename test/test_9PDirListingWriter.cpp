@@ -131,3 +131,172 @@ TEST_F(P9DirListingWriter, emptyDirectoryReadResponseOk) {
 	auto read = std::get<Response::Read>(message);
 	ASSERT_EQ(dirWriter.bytesEncoded(), read.data.size());
 }
+
+
+namespace  {
+
+Stat makeDirEntry(StringView name) {
+	Stat stat{};
+	stat.qid = {2, 0, 64};
+	stat.mode = 0644;
+	stat.length = 4096;
+	stat.name = name;
+	stat.uid = StringLiteral{"User"};
+	stat.gid = StringLiteral{"Glanda"};
+	stat.muid = StringLiteral{"User"};
+	stat.size = DirListingWriter::sizeStat(stat);
+
+	return stat;
+}
+
+}  // namespace
+
+
+TEST_F(P9DirListingWriter, cursorResumesListingAtTheNextEntry) {
+	Stat const entries[] = {
+		makeDirEntry("file-0"), makeDirEntry("file-1"), makeDirEntry("file-2"),
+		makeDirEntry("file-3"), makeDirEntry("file-4")
+	};
+	auto const entrySize = protocolSize(entries[0]);
+	auto const count = narrow_cast<uint32>(2 * entrySize + 1);
+
+	DirListingCursor cursor;
+	ASSERT_TRUE(cursor.seek(0, 7));
+	{
+		auto responseWriter = ResponseWriter{_buffer, 1};
+		auto dirWriter = DirListingWriter{responseWriter, count, 0, cursor};
+		for (uint64 i = cursor.index(); i < 5; ++i) {
+			if (!dirWriter.encode(entries[i], i + 1)) {
+				break;
+			}
+		}
+	}
+	EXPECT_EQ(2U, cursor.index());
+	EXPECT_EQ(2U, cursor.cookie());
+	EXPECT_EQ(2 * entrySize, cursor.offset());
+
+	// Next read continues where the previous one ended: no entries are fed again.
+	auto const offset = cursor.offset();
+	ASSERT_TRUE(cursor.seek(offset, 7));
+
+	_buffer.rewind();
+	uint64 entriesConsumed = 0;
+	auto responseWriter = ResponseWriter{_buffer, 1};
+	auto dirWriter = DirListingWriter{responseWriter, count, offset, cursor};
+	for (auto i = cursor.index(); i < 5; ++i, ++entriesConsumed) {
+		if (!dirWriter.encode(entries[i], i + 1)) {
+			break;
+		}
+	}
+	EXPECT_EQ(2U, entriesConsumed);
+	EXPECT_EQ(4U, cursor.index());
+	EXPECT_EQ(2 * entrySize, dirWriter.bytesEncoded());
+
+	// Response is the same as one produced by feeding all the entries from the start.
+	byte expected[512];
+	ByteWriter expectedBuffer{wrapMemory(expected)};
+	auto expectedResponseWriter = ResponseWriter{expectedBuffer, 1};
+	auto expectedDirWriter = DirListingWriter{expectedResponseWriter, count, offset};
+	for (auto const& entry : entries) {
+		if (!expectedDirWriter.encode(entry)) {
+			break;
+		}
+	}
+
+	ASSERT_EQ(expectedBuffer.viewWritten(), _buffer.viewWritten());
+}
+
+
+TEST_F(P9DirListingWriter, cursorIsResetWhenDirectoryChanges) {
+	DirListingCursor cursor;
+	ASSERT_TRUE(cursor.seek(0, 1));
+	cursor.advance(100, 42);
+
+	EXPECT_TRUE(cursor.seek(100, 1));
+	EXPECT_EQ(1U, cursor.index());
+
+	EXPECT_FALSE(cursor.seek(100, 2));
+	EXPECT_EQ(0U, cursor.index());
+	EXPECT_EQ(0U, cursor.offset());
+	EXPECT_EQ(0U, cursor.cookie());
+	EXPECT_EQ(2U, cursor.version());
+}
+
+
+TEST_F(P9DirListingWriter, encodeWithoutCookieKeepsCursorCookie) {
+	Stat const entries[] = {makeDirEntry("file-0"), makeDirEntry("file-1")};
+	auto const entrySize = protocolSize(entries[0]);
+
+	DirListingCursor cursor;
+	cursor.seek(0, 1);
+	cursor.advance(entrySize, 42);
+	ASSERT_TRUE(cursor.seek(entrySize, 1));
+
+	auto responseWriter = ResponseWriter{_buffer, 1};
+	auto dirWriter = DirListingWriter{responseWriter, 4096, entrySize, cursor};
+	ASSERT_TRUE(dirWriter.encode(entries[1]));
+
+	EXPECT_EQ(2U, cursor.index());
+	EXPECT_EQ(2 * entrySize, cursor.offset());
+	EXPECT_EQ(42U, cursor.cookie());
+}
+
+
+TEST_F(P9DirListingWriter, cursorIsResetOnUnexpectedOffset) {
+	Stat const entries[] = {makeDirEntry("file-0"), makeDirEntry("file-1"), makeDirEntry("file-2")};
+	auto const entrySize = protocolSize(entries[0]);
+
+	DirListingCursor cursor;
+	cursor.seek(0, 1);
+	cursor.advance(entrySize, 1);
+
+	// Client re-reads from an offset other than where the previous read ended: entries are skipped from the start.
+	ASSERT_FALSE(cursor.seek(2 * entrySize, 1));
+
+	auto responseWriter = ResponseWriter{_buffer, 1};
+	auto dirWriter = DirListingWriter{responseWriter, 4096, 2 * entrySize, cursor};
+	for (auto i = cursor.index(); i < 3; ++i) {
+		ASSERT_TRUE(dirWriter.encode(entries[i], i + 1));
+	}
+
+	EXPECT_EQ(entrySize, dirWriter.bytesEncoded());
+	EXPECT_EQ(3U, cursor.index());
+	EXPECT_EQ(3 * entrySize, cursor.offset());
+}
+
+
+TEST_F(P9DirListingWriter, statReaderReadsDirectoryListing) {
+	Stat const entries[] = {makeDirEntry("file-0"), makeDirEntry("other-file"), makeDirEntry("f")};
+
+	auto responseWriter = ResponseWriter{_buffer, 1};
+	auto dirWriter = DirListingWriter{responseWriter, 4096};
+	for (auto const& entry : entries) {
+		ASSERT_TRUE(dirWriter.encode(entry));
+	}
+
+	auto parser = createResponseParser(kProtocolVersion, kMaxMessageSize).unwrap();
+	ByteReader reader{_buffer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	auto message = parser.parseResponse(*header, reader);
+	ASSERT_TRUE(message.isOk());
+
+	StatReader<Stat> statReader{std::get<Response::Read>(*message).data};
+	ASSERT_EQ(3U, statReader.count());
+
+	size_t index = 0;
+	for (auto const stat : statReader) {
+		ASSERT_TRUE(stat.isOk());
+		ASSERT_EQ(entries[index], *stat);
+		index += 1;
+	}
+	ASSERT_EQ(3U, index);
+}
+
+
+TEST_F(P9DirListingWriter, statReaderOfEmptyListing) {
+	StatReader<Stat> statReader{MemoryView{}};
+
+	ASSERT_EQ(0U, statReader.count());
+	ASSERT_EQ(statReader.begin(), statReader.end());
+}
@@ -0,0 +1,152 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_arena.cpp
+ *
+ *******************************************************************************/
+#include "styxe/arena.hpp"  // Class being tested
+#include "styxe/9p2000u.hpp"
+
+#include "testHarnes.hpp"
+
+#include <cstring>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class ArenaTest : public TestHarnes {
+protected:
+
+	RequestMessage parseRequest() {
+		ByteReader reader{_writer.viewWritten()};
+		auto parser = createRequestParser(kProtocolVersion, kMaxMessageSize).unwrap();
+		auto header = parseMessageHeader(reader).unwrap();
+
+		return parser.parseRequest(header, reader).unwrap();
+	}
+
+	/// Overwrite the receive buffer, as if it was reused for the next message.
+	void recycleBuffer() {
+		_memBuf.view().fill(0xFE);
+	}
+
+	byte	_arenaBuffer[256];
+	Arena	_arena{wrapMemory(_arenaBuffer)};
+};
+
+}  // namespace
+
+
+TEST_F(ArenaTest, allocateAndReset) {
+	EXPECT_EQ(sizeof(_arenaBuffer), _arena.capacity());
+
+	auto block = _arena.allocate(200);
+	ASSERT_TRUE(block.isOk());
+	EXPECT_EQ(200U, block.unwrap().size());
+	EXPECT_EQ(56U, _arena.remaining());
+	EXPECT_TRUE(_arena.allocate(57).isError());
+
+	_arena.reset();
+	EXPECT_EQ(0U, _arena.size());
+	EXPECT_TRUE(_arena.allocate(256).isOk());
+}
+
+
+TEST_F(ArenaTest, clonedWalkRequestOutlivesReceiveBuffer) {
+	RequestWriter writer{_writer, 1};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{"space"}
+		   << StringView{"knowhere"};
+
+	auto maybeClone = clone(parseRequest(), _arena);
+	ASSERT_TRUE(maybeClone.isOk());
+	recycleBuffer();
+
+	auto const& request = std::get<Request::Walk>(maybeClone.unwrap());
+	EXPECT_EQ(213U, request.fid);
+	EXPECT_EQ(124U, request.newfid);
+	ASSERT_EQ(2U, request.path.size());
+	auto segment = request.path.begin();
+	EXPECT_EQ("space", *segment);
+	EXPECT_EQ("knowhere", *(++segment));
+	EXPECT_EQ(2U + 5 + 2 + 8, _arena.size());
+}
+
+
+TEST_F(ArenaTest, clonedWriteRequestCopiesPayload) {
+	char const content[] = "Some data to be written";
+	RequestWriter writer{_writer, 1};
+	writer << Request::Write{42, 7, wrapMemory(content)};
+
+	auto maybeClone = clone(parseRequest(), _arena);
+	ASSERT_TRUE(maybeClone.isOk());
+	recycleBuffer();
+
+	auto const& request = std::get<Request::Write>(maybeClone.unwrap());
+	EXPECT_EQ(42U, request.fid);
+	EXPECT_EQ(7U, request.offset);
+	EXPECT_EQ(wrapMemory(content), request.data);
+}
+
+
+TEST_F(ArenaTest, clonedStatResponseCopiesStrings) {
+	char names[] = "file" "user" "group" "link";
+
+	_9P2000U::Response::Stat response{};
+	response.data.name = StringView{names, 4};
+	response.data.uid = StringView{names + 4, 4};
+	response.data.gid = StringView{names + 8, 5};
+	response.data.extension = StringView{names + 13, 4};
+
+	auto maybeClone = clone(ResponseMessage{response}, _arena);
+	ASSERT_TRUE(maybeClone.isOk());
+	memset(names, '?', sizeof(names));
+
+	auto const& stat = std::get<_9P2000U::Response::Stat>(maybeClone.unwrap()).data;
+	EXPECT_EQ("file", stat.name);
+	EXPECT_EQ("user", stat.uid);
+	EXPECT_EQ("group", stat.gid);
+	EXPECT_EQ("link", stat.extension);
+	EXPECT_TRUE(stat.muid.empty());
+}
+
+
+TEST_F(ArenaTest, cloneFailsWhenArenaIsExhausted) {
+	byte payload[300] = {};
+	RequestWriter writer{_writer, 1};
+	writer << Request::Write{42, 7, wrapMemory(payload)};
+
+	EXPECT_TRUE(clone(parseRequest(), _arena).isError());
+	EXPECT_EQ(0U, _arena.size());
+}
+
+
+TEST_F(ArenaTest, partialCloneIsReleasedWhenArenaIsExhausted) {
+	char aname[200] = {};
+	std::memset(aname, 'a', sizeof(aname) - 1);
+
+	RequestWriter writer{_writer, 1};
+	writer << Request::Attach{1, kNoFID, "user", StringView{aname}};
+
+	ASSERT_TRUE(_arena.allocate(100).isOk());
+	EXPECT_TRUE(clone(parseRequest(), _arena).isError());  // uname fits, aname does not
+	EXPECT_EQ(100U, _arena.size());
+}
@@ -0,0 +1,250 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_dialectParser.cpp
+ *
+ *******************************************************************************/
+#include "styxe/dialectParser.hpp"
+#include "styxe/messageWriter.hpp"
+
+#include "testHarnes.hpp"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class DialectParser : public TestHarnes {
+protected:
+
+	template<typename Dialect>
+	styxe::Result<typename Dialect::RequestMessage> parseRequest() {
+		ByteReader reader{_writer.viewWritten()};
+
+		BasicRequestParser<Dialect> parser{kMaxMessageSize};
+		return parseMessageHeader(reader)
+				.then([&](MessageHeader header) {
+					return parser.parseRequest(header, reader);
+				});
+	}
+
+	template<typename Dialect>
+	styxe::Result<typename Dialect::ResponseMessage> parseResponse() {
+		ByteReader reader{_writer.viewWritten()};
+
+		BasicResponseParser<Dialect> parser{kMaxMessageSize};
+		return parseMessageHeader(reader)
+				.then([&](MessageHeader header) {
+					return parser.parseResponse(header, reader);
+				});
+	}
+};
+
+
+/// A handler that only accepts alternatives of a dialect message variant.
+template<typename Message>
+struct DialectHandler {
+	template<typename T>
+	void operator() (T const& message) {
+		static_assert(styxe::detail::IsAlternativeOf<T, Message>::value, "Handler only accepts messages of the dialect");
+		handled = message;
+		nCalls += 1;
+	}
+
+	Message	handled{};
+	int		nCalls{0};
+};
+
+}  // namespace
+
+
+static_assert(std::variant_size<_9P2000::RequestMessage>::value < std::variant_size<RequestMessage>::value,
+			  "Dialect variant must only hold messages of the dialect");
+static_assert(!styxe::detail::IsAlternativeOf<_9P2000L::Request::GetAttr, _9P2000::RequestMessage>::value,
+			  "9P2000 dialect must not hold 9P2000.L messages");
+static_assert(styxe::detail::IsAlternativeOf<_9P2000U::Request::Attach, _9P2000L::RequestMessage>::value &&
+			  !styxe::detail::IsAlternativeOf<Request::Attach, _9P2000L::RequestMessage>::value,
+			  "9P2000.L dialect must hold 9P2000.u versions of redefined messages");
+
+
+TEST_F(DialectParser, parseHotPathRequest) {
+	RequestWriter writer{_writer, 1};
+	writer << Request::Read{32, 8, 1024};
+
+	auto maybeMessage = parseRequest<_9P2000::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+	ASSERT_TRUE(std::holds_alternative<Request::Read>(*maybeMessage));
+
+	auto& request = std::get<Request::Read>(*maybeMessage);
+	EXPECT_EQ(32U, request.fid);
+	EXPECT_EQ(8U, request.offset);
+	EXPECT_EQ(1024U, request.count);
+}
+
+
+TEST_F(DialectParser, extendedDialectOverridesBaseMessages) {
+	RequestWriter writer{_writer, 1};
+	writer << _9P2000U::Request::Attach{3, kNoFID, "user", "/", 19};
+
+	auto maybeMessage = parseRequest<_9P2000U::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+	ASSERT_TRUE(std::holds_alternative<_9P2000U::Request::Attach>(*maybeMessage));
+	EXPECT_EQ(19U, std::get<_9P2000U::Request::Attach>(*maybeMessage).n_uname);
+}
+
+
+TEST_F(DialectParser, extendedDialectParsesBaseMessages) {
+	RequestWriter writer{_writer, 1};
+	writer << Request::Clunk{81};
+
+	auto maybeMessage = parseRequest<_9P2000L::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+	ASSERT_TRUE(std::holds_alternative<Request::Clunk>(*maybeMessage));
+	EXPECT_EQ(81U, std::get<Request::Clunk>(*maybeMessage).fid);
+}
+
+
+TEST_F(DialectParser, messagesOfOtherDialectsAreNotSupported) {
+	RequestWriter writer{_writer, 1};
+	writer << _9P2000L::Request::GetAttr{8193, 71641};
+
+	ASSERT_TRUE(parseRequest<_9P2000L::Dialect>().isOk());
+	ASSERT_TRUE(parseRequest<_9P2000E::Dialect>().isError());
+	ASSERT_TRUE(parseRequest<_9P2000U::Dialect>().isError());
+	ASSERT_TRUE(parseRequest<_9P2000::Dialect>().isError());
+}
+
+
+TEST_F(DialectParser, parseResponse) {
+	ResponseWriter writer{_writer, 1};
+	writer << _9P2000E::Response::Session{};
+
+	auto maybeMessage = parseResponse<_9P2000E::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+	ASSERT_TRUE(std::holds_alternative<_9P2000E::Response::Session>(*maybeMessage));
+
+	ASSERT_TRUE(parseResponse<_9P2000L::Dialect>().isError());
+}
+
+
+TEST_F(DialectParser, parseRequestWithHandler) {
+	RequestWriter writer{_writer, 1};
+	writer << Request::Clunk{81};
+
+	ByteReader reader{_writer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+
+	Fid clunkedFid = 0;
+	BasicRequestParser<_9P2000L::Dialect> parser{kMaxMessageSize};
+	auto result = parser.parseRequest(*header, reader, [&clunkedFid](auto const& request) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(request)>, Request::Clunk>) {
+			clunkedFid = request.fid;
+		} else {
+			FAIL() << "Unexpected request type";
+		}
+	});
+
+	ASSERT_TRUE(result.isOk());
+	EXPECT_EQ(81U, clunkedFid);
+}
+
+
+TEST_F(DialectParser, parseResponseWithHandlerReportsUnsupportedMessages) {
+	ResponseWriter writer{_writer, 1};
+	writer << _9P2000E::Response::Session{};
+
+	ByteReader reader{_writer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+
+	BasicResponseParser<_9P2000U::Dialect> parser{kMaxMessageSize};
+	auto result = parser.parseResponse(*header, reader, [](auto const&) {
+		FAIL() << "Handler should not be called for unsupported messages";
+	});
+
+	ASSERT_TRUE(result.isError());
+}
+
+
+TEST_F(DialectParser, handlerOnlyReceivesRequestsOfTheDialect) {
+	RequestWriter writer{_writer, 1};
+	writer << _9P2000U::Request::Attach{3, kNoFID, "user", "/", 19};
+
+	ByteReader reader{_writer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+
+	DialectHandler<_9P2000U::RequestMessage> handler;
+	BasicRequestParser<_9P2000U::Dialect> parser{kMaxMessageSize};
+	auto result = parser.parseRequest(*header, reader, handler);
+
+	ASSERT_TRUE(result.isOk());
+	EXPECT_EQ(1, handler.nCalls);
+	ASSERT_TRUE(std::holds_alternative<_9P2000U::Request::Attach>(handler.handled));
+	EXPECT_EQ(19U, std::get<_9P2000U::Request::Attach>(handler.handled).n_uname);
+}
+
+
+TEST_F(DialectParser, handlerOnlyReceivesResponsesOfTheDialect) {
+	ResponseWriter writer{_writer, 1};
+	writer << _9P2000U::Response::Error{StringLiteral{"Nope"}, 17};
+
+	ByteReader reader{_writer.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+
+	DialectHandler<_9P2000L::ResponseMessage> handler;
+	BasicResponseParser<_9P2000L::Dialect> parser{kMaxMessageSize};
+	auto result = parser.parseResponse(*header, reader, handler);
+
+	ASSERT_TRUE(result.isOk());
+	EXPECT_EQ(1, handler.nCalls);
+	ASSERT_TRUE(std::holds_alternative<_9P2000U::Response::Error>(handler.handled));
+	EXPECT_EQ(17U, std::get<_9P2000U::Response::Error>(handler.handled).errcode);
+}
+
+
+TEST_F(DialectParser, convertDialectRequestToRequestMessage) {
+	RequestWriter writer{_writer, 1};
+	writer << _9P2000L::Request::GetAttr{8193, 71641};
+
+	auto maybeMessage = parseRequest<_9P2000L::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+
+	RequestMessage request = toRequestMessage(*maybeMessage);
+	ASSERT_TRUE(std::holds_alternative<_9P2000L::Request::GetAttr>(request));
+	EXPECT_EQ(8193U, std::get<_9P2000L::Request::GetAttr>(request).fid);
+	EXPECT_EQ(71641U, std::get<_9P2000L::Request::GetAttr>(request).request_mask);
+}
+
+
+TEST_F(DialectParser, convertDialectResponseToResponseMessage) {
+	ResponseWriter writer{_writer, 1};
+	auto const testError = StringLiteral{"Nope"};
+	writer << _9P2000U::Response::Error{testError, 17};
+
+	auto maybeMessage = parseResponse<_9P2000U::Dialect>();
+	ASSERT_TRUE(maybeMessage.isOk());
+
+	ResponseMessage response = toResponseMessage(mv(*maybeMessage));
+	ASSERT_TRUE(std::holds_alternative<_9P2000U::Response::Error>(response));
+	EXPECT_EQ(testError, std::get<_9P2000U::Response::Error>(response).ename);
+	EXPECT_EQ(17U, std::get<_9P2000U::Response::Error>(response).errcode);
+}
@@ -0,0 +1,104 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_fixedFrame.cpp
+ *
+ *******************************************************************************/
+#include "styxe/fixedFrame.hpp"  // Class being tested
+#include "styxe/9p2000L.hpp"
+#include "styxe/messageParser.hpp"
+
+#include "testHarnes.hpp"
+
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+static_assert(FixedFrame<Response::Clunk>::kSize == 7, "RClunk is a header only");
+static_assert(FixedFrame<Response::Write>::kSize == 11, "RWrite is a header and a count");
+static_assert(FixedFrame<_9P2000L::Response::Lock>::kSize == 8, "Rlock is a header and a status");
+static_assert(FixedFrame<Response::Flush>::encode(0x0201)[6] == 0x02, "Frame is encoded at compile time");
+
+
+namespace  {
+
+class FixedFrames : public TestHarnes {
+protected:
+
+	/// Check that a pre-encoded frame is identical to a frame written by a ResponseWriter.
+	template<typename Message>
+	void expectSameAsWritten(Message const& message = {}) {
+		_writer.rewind();
+		ResponseWriter writer{_writer, 0x1A2B};
+		writer << message;
+		auto const written = _writer.viewWritten();
+
+		byte buffer[32];
+		ByteWriter dest{wrapMemory(buffer)};
+		ASSERT_TRUE(FixedFrame<Message>::write(dest, 0x1A2B, message).isOk());
+		EXPECT_EQ(written, dest.viewWritten());
+	}
+};
+
+}  // namespace
+
+
+TEST_F(FixedFrames, headerOnlyResponsesMatchWriter) {
+	expectSameAsWritten<Response::Clunk>();
+	expectSameAsWritten<Response::Flush>();
+	expectSameAsWritten<Response::Remove>();
+	expectSameAsWritten<Response::WStat>();
+	expectSameAsWritten<_9P2000L::Response::SetAttr>();
+	expectSameAsWritten<_9P2000L::Response::FSync>();
+	expectSameAsWritten<_9P2000L::Response::Link>();
+	expectSameAsWritten<_9P2000L::Response::Rename>();
+	expectSameAsWritten<_9P2000L::Response::RenameAt>();
+	expectSameAsWritten<_9P2000L::Response::UnlinkAt>();
+	expectSameAsWritten<_9P2000L::Response::XAttrCreate>();
+}
+
+
+TEST_F(FixedFrames, responsesWithFieldsMatchWriter) {
+	expectSameAsWritten(Response::Write{0x01020304});
+	expectSameAsWritten(_9P2000L::Response::Lock{1});
+	expectSameAsWritten(Response::Open{randomQid(), 8192});
+}
+
+
+TEST_F(FixedFrames, writtenFrameIsParsed) {
+	ASSERT_TRUE(FixedFrame<Response::Write>::write(_writer, 42, Response::Write{3}).isOk());
+
+	ByteReader reader{_writer.viewWritten()};
+	auto maybeHeader = parseMessageHeader(reader);
+	ASSERT_TRUE(maybeHeader.isOk());
+	EXPECT_EQ(42, maybeHeader.unwrap().tag);
+
+	Response::Write response;
+	ASSERT_TRUE((reader >> response).isOk());
+	EXPECT_EQ(3U, response.count);
+}
+
+
+TEST_F(FixedFrames, writeFailsWhenNoSpace) {
+	byte buffer[6];
+	ByteWriter dest{wrapMemory(buffer)};
+	EXPECT_TRUE(FixedFrame<Response::Clunk>::write(dest, 1).isError());
+	EXPECT_EQ(0U, dest.position());
+}
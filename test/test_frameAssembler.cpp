@@ -0,0 +1,137 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_frameAssembler.cpp
+ *
+ *******************************************************************************/
+#include "styxe/frameAssembler.hpp"
+#include "styxe/messageWriter.hpp"
+#include "styxe/messageParser.hpp"
+
+#include "testHarnes.hpp"
+
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class FrameAssemblerTest : public TestHarnes {
+protected:
+
+	void SetUp() override {
+		TestHarnes::SetUp();
+
+		RequestWriter clunk{_writer, 1};
+		clunk << Request::Clunk{17};
+
+		RequestWriter read{_writer, 2};
+		read << Request::Read{32, 0, 128};
+
+		RequestWriter attach{_writer, 3};
+		attach << Request::Attach{1, kNoFID, "user", "/some/long/path"};
+	}
+
+	styxe::Result<void> feed(MemoryView chunk) {
+		return _assembler.feed(chunk, [this](MessageHeader header, ByteReader& payload) {
+			_tags.push_back(header.tag);
+
+			auto maybeParser = createRequestParser(kProtocolVersion, kStagingSize);
+			auto maybeMessage = maybeParser.unwrap().parseRequest(header, payload);
+			if (!maybeMessage) {
+				logFailure(maybeMessage.getError());
+			}
+		});
+	}
+
+	static constexpr size_type kStagingSize = 512;
+
+	byte					_staging[kStagingSize];
+	FrameAssembler			_assembler{wrapMemory(_staging), kStagingSize};
+	std::vector<Tag>		_tags;
+};
+
+}  // namespace
+
+
+TEST_F(FrameAssemblerTest, wholeFramesAreYieldedWithoutStaging) {
+	ASSERT_TRUE(feed(_writer.viewWritten()).isOk());
+
+	ASSERT_EQ((std::vector<Tag>{1, 2, 3}), _tags);
+	ASSERT_EQ(0U, _assembler.pending());
+}
+
+
+TEST_F(FrameAssemblerTest, partialTailIsStaged) {
+	auto const data = _writer.viewWritten();
+	auto const split = data.size() - 3;
+
+	ASSERT_TRUE(feed(data.slice(0, split)).isOk());
+	ASSERT_EQ((std::vector<Tag>{1, 2}), _tags);
+	ASSERT_LT(0U, _assembler.pending());
+
+	ASSERT_TRUE(feed(data.slice(split, data.size())).isOk());
+	ASSERT_EQ((std::vector<Tag>{1, 2, 3}), _tags);
+	ASSERT_EQ(0U, _assembler.pending());
+}
+
+
+TEST_F(FrameAssemblerTest, byteByByteFeed) {
+	auto const data = _writer.viewWritten();
+	for (MemoryView::size_type i = 0; i < data.size(); ++i) {
+		ASSERT_TRUE(feed(data.slice(i, i + 1)).isOk());
+	}
+
+	ASSERT_EQ((std::vector<Tag>{1, 2, 3}), _tags);
+	ASSERT_EQ(0U, _assembler.pending());
+}
+
+
+TEST_F(FrameAssemblerTest, frameSpreadOverChunksIsFollowedByWholeFrames) {
+	auto const data = _writer.viewWritten();
+
+	ASSERT_TRUE(feed(data.slice(0, 3)).isOk());
+	ASSERT_TRUE(_tags.empty());
+
+	ASSERT_TRUE(feed(data.slice(3, data.size())).isOk());
+	ASSERT_EQ((std::vector<Tag>{1, 2, 3}), _tags);
+	ASSERT_EQ(0U, _assembler.pending());
+}
+
+
+TEST_F(FrameAssemblerTest, frameTooBigIsRejected) {
+	_writer.rewind();
+	styxe::Encoder encoder{_writer};
+	encoder << makeHeaderWithPayload(asByte(MessageType::TRead), 1, kStagingSize);
+
+	ASSERT_TRUE(feed(_writer.viewWritten()).isError());
+	ASSERT_TRUE(_tags.empty());
+}
+
+
+TEST_F(FrameAssemblerTest, frameTooShortIsRejected) {
+	_writer.rewind();
+	styxe::Encoder encoder{_writer};
+	encoder << MessageHeader{3, asByte(MessageType::TRead), 1};
+
+	ASSERT_TRUE(feed(_writer.viewWritten().slice(0, 5)).isOk());
+	ASSERT_TRUE(feed(_writer.viewWritten().slice(5, headerSize())).isError());
+	ASSERT_TRUE(_tags.empty());
+}
@@ -0,0 +1,146 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_ioVecWriter.cpp
+ *
+ *******************************************************************************/
+#include "styxe/ioVecWriter.hpp"  // Class being tested
+
+#include "testHarnes.hpp"
+
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class IoVecWriterTest : public TestHarnes {
+protected:
+
+	/// Concatenate buffers pointed to by io vectors, as writev would do.
+	static std::vector<byte> gather(iovec const* vecs, int count) {
+		std::vector<byte> result;
+		for (int i = 0; i < count; ++i) {
+			auto const base = static_cast<byte const*>(vecs[i].iov_base);
+			result.insert(result.end(), base, base + vecs[i].iov_len);
+		}
+
+		return result;
+	}
+
+	/// Encode a message with a regular, copying, writer.
+	template<typename Writer, typename Message>
+	std::vector<byte> encodeCopy(Message const& message) {
+		byte buffer[128];
+		ByteWriter dest{wrapMemory(buffer)};
+		Writer writer{dest, 7};
+		writer << message;
+
+		auto const encoded = dest.viewWritten();
+		return {encoded.dataAddress(), encoded.dataAddress() + encoded.size()};
+	}
+
+	char const _payload[36] = "This is a very important data d-_^b";
+};
+
+}  // namespace
+
+
+TEST_F(IoVecWriterTest, readResponseReferencesPayload) {
+	auto const data = wrapMemory(_payload);
+
+	ResponseIoVecWriter writer{_writer, 7};
+	writer << Response::Read{data};
+
+	ASSERT_EQ(2, writer.ioVecCount());
+	auto const vecs = writer.ioVecs();
+	EXPECT_EQ(headerSize() + sizeof(size_type), vecs[0].iov_len);
+	EXPECT_EQ(data.dataAddress(), vecs[1].iov_base);
+	EXPECT_EQ(data.size(), vecs[1].iov_len);
+
+	// Only header and data size are written into the buffer
+	EXPECT_EQ(headerSize() + sizeof(size_type), _writer.position());
+	EXPECT_EQ(headerSize() + sizeof(size_type) + data.size(), writer.header().messageSize);
+
+	EXPECT_EQ(encodeCopy<ResponseWriter>(Response::Read{data}), gather(vecs, writer.ioVecCount()));
+}
+
+
+TEST_F(IoVecWriterTest, emptyReadResponseHasNoPayloadVector) {
+	ResponseIoVecWriter writer{_writer, 7};
+	writer << Response::Read{};
+
+	ASSERT_EQ(1, writer.ioVecCount());
+	EXPECT_EQ(encodeCopy<ResponseWriter>(Response::Read{}), gather(writer.ioVecs(), writer.ioVecCount()));
+}
+
+
+TEST_F(IoVecWriterTest, writeRequestMatchesCopyingWriter) {
+	Request::Write message{};
+	message.fid = 32;
+	message.offset = 8192;
+	message.data = wrapMemory(_payload);
+
+	RequestIoVecWriter writer{_writer, 7};
+	writer << message;
+
+	ASSERT_EQ(2, writer.ioVecCount());
+	auto const vecs = writer.ioVecs();
+	EXPECT_EQ(message.data.dataAddress(), vecs[1].iov_base);
+	EXPECT_EQ(encodeCopy<RequestWriter>(message), gather(vecs, writer.ioVecCount()));
+}
+
+
+TEST_F(IoVecWriterTest, shortWriteRequestMatchesCopyingWriter) {
+	byte buffer[14 + 2*3];
+	ByteWriter pathWriter{wrapMemory(buffer)};
+	styxe::Encoder encoder{pathWriter};
+	encoder << StringView{"some"}
+			<< StringView{"wierd"}
+			<< StringView{"place"};
+
+	_9P2000E::Request::ShortWrite message{};
+	message.fid = 32;
+	message.path = WalkPath{3, wrapMemory(buffer)};
+	message.data = wrapMemory(_payload);
+
+	RequestIoVecWriter writer{_writer, 7};
+	writer << message;
+
+	ASSERT_EQ(2, writer.ioVecCount());
+	EXPECT_EQ(encodeCopy<RequestWriter>(message), gather(writer.ioVecs(), writer.ioVecCount()));
+}
+
+
+TEST_F(IoVecWriterTest, messagesAreAppendedToTheBuffer) {
+	auto const data = wrapMemory(_payload);
+
+	ResponseIoVecWriter first{_writer, 1};
+	first << Response::Read{data};
+
+	ResponseIoVecWriter second{_writer, 2};
+	second << _9P2000E::Response::ShortRead{data};
+
+	auto const vecs = second.ioVecs();
+	ASSERT_EQ(2, second.ioVecCount());
+	EXPECT_EQ(_memBuf.view().dataAddress(headerSize() + sizeof(size_type)), vecs[0].iov_base);
+	EXPECT_EQ(headerSize() + sizeof(size_type), vecs[0].iov_len);
+	EXPECT_EQ(data.dataAddress(), vecs[1].iov_base);
+}
@@ -0,0 +1,137 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_messageBufferPool.cpp
+ *
+ *******************************************************************************/
+#include "styxe/messageBufferPool.hpp"  // Class being tested
+#include "styxe/messageParser.hpp"
+
+#include "testHarnes.hpp"
+
+#include <thread>
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class MessageBufferPoolTest : public ::testing::Test {
+protected:
+	MemoryManager		_memManager{1024 * 1024};
+	MessageBufferPool	_pool{_memManager, 8 * 1024};
+};
+
+}  // namespace
+
+
+TEST_F(MessageBufferPoolTest, sizeClassesAreDerivedFromMaxMessageSize) {
+	ASSERT_EQ(6U, _pool.sizeClassCount());  // 256, 512, 1k, 2k, 4k, 8k
+	EXPECT_EQ(MessageBufferPool::kMinBufferSize, _pool.stats(0).bufferSize);
+	EXPECT_EQ(8U * 1024, _pool.stats(5).bufferSize);
+
+	EXPECT_EQ(0U, _pool.sizeClassOf(7));
+	EXPECT_EQ(0U, _pool.sizeClassOf(256));
+	EXPECT_EQ(1U, _pool.sizeClassOf(257));
+	EXPECT_EQ(5U, _pool.sizeClassOf(8 * 1024));
+
+	MessageBufferPool oddPool{_memManager, 5000};
+	ASSERT_EQ(6U, oddPool.sizeClassCount());
+	EXPECT_EQ(5000U, oddPool.stats(oddPool.sizeClassOf(4097)).bufferSize);
+}
+
+
+TEST_F(MessageBufferPoolTest, acquireForMessage) {
+	auto maybeBuffer = _pool.acquireFor(Response::Write{12});
+	ASSERT_TRUE(maybeBuffer.isOk());
+
+	auto& buffer = maybeBuffer.unwrap();
+	EXPECT_EQ(MessageBufferPool::kMinBufferSize, buffer.capacity());
+
+	auto dest = buffer.writer();
+	ResponseWriter writer{dest, 3};
+	writer << Response::Write{12};
+
+	auto reader = buffer.reader(dest.position());
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	EXPECT_EQ(3, header.unwrap().tag);
+
+	EXPECT_EQ(8U * 1024, _pool.acquire().unwrap().capacity());
+	EXPECT_TRUE(_pool.acquire(8 * 1024 + 1).isError());
+}
+
+
+TEST_F(MessageBufferPoolTest, releasedBuffersAreReused) {
+	byte const* address = nullptr;
+	{
+		auto buffer = _pool.acquire(1000).unwrap();
+		address = buffer.view().dataAddress();
+	}
+
+	auto buffer = _pool.acquire(600).unwrap();
+	EXPECT_EQ(address, buffer.view().dataAddress());
+
+	auto const stats = _pool.stats(_pool.sizeClassOf(1000));
+	EXPECT_EQ(1U, stats.allocated);
+	EXPECT_EQ(1U, stats.inUse);
+}
+
+
+TEST_F(MessageBufferPoolTest, highWaterMarks) {
+	{
+		std::vector<MessageBufferPool::Buffer> buffers;
+		for (int i = 0; i < 3; ++i) {
+			buffers.emplace_back(_pool.acquire(100).unwrap());
+		}
+		buffers.emplace_back(_pool.acquire(2000).unwrap());
+	}
+
+	auto const stats = _pool.stats(0);
+	EXPECT_EQ(0U, stats.inUse);
+	EXPECT_EQ(3U, stats.allocated);
+	EXPECT_EQ(3U, stats.highWaterMark);
+	EXPECT_EQ(3U * 256 + 2048, _pool.highWaterBytes());
+
+	auto buffer = _pool.acquire(100).unwrap();
+	EXPECT_EQ(3U, _pool.stats(0).allocated);
+	EXPECT_EQ(3U * 256 + 2048, _pool.highWaterBytes());
+}
+
+
+TEST_F(MessageBufferPoolTest, buffersReleasedOnOtherThreadAreReused) {
+	std::vector<MessageBufferPool::Buffer> buffers;
+	for (int i = 0; i < 8; ++i) {
+		buffers.emplace_back(_pool.acquire(512).unwrap());
+	}
+
+	std::thread releaser{[&buffers]() noexcept {
+		buffers.clear();
+	}};
+	releaser.join();
+
+	EXPECT_EQ(0U, _pool.stats(1).inUse);
+	for (int i = 0; i < 8; ++i) {
+		buffers.emplace_back(_pool.acquire(512).unwrap());
+	}
+
+	EXPECT_EQ(8U, _pool.stats(1).allocated);
+	EXPECT_EQ(8U, _pool.stats(1).inUse);
+}
@@ -20,11 +20,15 @@
  *
  *******************************************************************************/
 #include "styxe/messageParser.hpp"
+#include "styxe/messageWriter.hpp"
 
 #include <solace/output_utils.hpp>
 
 #include <gtest/gtest.h>
 
+#include <iterator>  // std::back_inserter
+#include <vector>
+
 
 using namespace Solace;
 using namespace styxe;
@@ -144,7 +148,167 @@ TEST(P9, parseIncorrectlySizedLargerResponse) {
 }
 
 
+TEST(P9, parseRequestWithTruncatedFixedFields) {
+	byte buffer[32];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+
+	// Frame is consistent with its header, but is too short to hold all of the fixed size fields of TRead.
+	styxe::Encoder encoder{byteStream};
+	encoder << makeHeaderWithPayload(asByte(MessageType::TRead), 1, sizeof(Fid) + sizeof(uint32))
+			<< Fid{17}
+			<< uint32{0};
+
+	auto reader = ByteReader{byteStream.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+
+	auto maybeParser = createRequestParser(kProtocolVersion, 32);
+	ASSERT_TRUE(maybeParser.isOk());
+
+	auto message = maybeParser.unwrap().parseRequest(*header, reader);
+	ASSERT_TRUE(message.isError());
+}
+
+
 TEST(P9, creatingUnsupportedVersionParserShouldFail) {
 	ASSERT_TRUE(createRequestParser("Fancy", 128).isError());
 	ASSERT_TRUE(createResponseParser("Style", 64).isError());
 }
+
+
+TEST(P9, parseRequestsFromBufferOfBackToBackFrames) {
+	byte buffer[128];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+
+	RequestWriter clunk{byteStream, 1};
+	clunk << Request::Clunk{17};
+
+	RequestWriter read{byteStream, 2};
+	read << Request::Read{32, 0, 128};
+
+	auto const lastFrameStart = byteStream.position();
+	RequestWriter open{byteStream, 3};
+	open << Request::Open{42, OpenMode::READ};
+
+	auto parser = createRequestParser(kProtocolVersion, 128);
+	ASSERT_TRUE(parser.isOk());
+
+	// Last frame is truncated
+	auto reader = ByteReader{byteStream.viewWritten().slice(0, byteStream.position() - 1)};
+	std::vector<ParsedRequest> requests;
+	auto result = parser.unwrap().parseRequests(reader, std::back_inserter(requests));
+	ASSERT_TRUE(result.isOk());
+	ASSERT_EQ(lastFrameStart, *result);
+	ASSERT_EQ(lastFrameStart, reader.position());
+
+	ASSERT_EQ(2U, requests.size());
+	EXPECT_EQ(1, requests[0].header.tag);
+	ASSERT_TRUE(std::holds_alternative<Request::Clunk>(requests[0].message));
+	EXPECT_EQ(17U, std::get<Request::Clunk>(requests[0].message).fid);
+
+	EXPECT_EQ(2, requests[1].header.tag);
+	ASSERT_TRUE(std::holds_alternative<Request::Read>(requests[1].message));
+	EXPECT_EQ(128U, std::get<Request::Read>(requests[1].message).count);
+}
+
+
+TEST(P9, parseResponsesStopsAtInvalidFrame) {
+	byte buffer[128];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+
+	ResponseWriter clunk{byteStream, 1};
+	clunk << Response::Clunk{};
+	auto const badFrameStart = byteStream.position();
+
+	styxe::Encoder encoder{byteStream};
+	encoder << makeHeaderWithPayload(asByte(MessageType::TRead), 2, 0);
+
+	auto parser = createResponseParser(kProtocolVersion, 128);
+	ASSERT_TRUE(parser.isOk());
+
+	auto reader = ByteReader{byteStream.viewWritten()};
+	std::vector<ParsedResponse> responses;
+	auto result = parser.unwrap().parseResponses(reader, std::back_inserter(responses));
+	ASSERT_TRUE(result.isError());
+	ASSERT_EQ(badFrameStart, reader.position());
+
+	ASSERT_EQ(1U, responses.size());
+	EXPECT_EQ(1, responses[0].header.tag);
+	EXPECT_TRUE(std::holds_alternative<Response::Clunk>(responses[0].message));
+}
+
+
+TEST(P9, parseRequestIntoReusedStorage) {
+	byte buffer[128];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+
+	RequestWriter read{byteStream, 1};
+	read << Request::Read{32, 0, 128};
+	auto const secondFrameStart = byteStream.position();
+
+	RequestWriter clunk{byteStream, 2};
+	clunk << Request::Clunk{17};
+
+	auto parser = createRequestParser(kProtocolVersion, 128);
+	ASSERT_TRUE(parser.isOk());
+
+	RequestMessage request;
+	auto reader = ByteReader{byteStream.viewWritten().slice(0, secondFrameStart)};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	ASSERT_TRUE(parser.unwrap().parseRequest(*header, reader, request).isOk());
+	ASSERT_TRUE(std::holds_alternative<Request::Read>(request));
+	EXPECT_EQ(128U, std::get<Request::Read>(request).count);
+
+	reader = ByteReader{byteStream.viewWritten().slice(secondFrameStart, byteStream.position())};
+	header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	ASSERT_TRUE(parser.unwrap().parseRequest(*header, reader, request).isOk());
+	ASSERT_TRUE(std::holds_alternative<Request::Clunk>(request));
+	EXPECT_EQ(17U, std::get<Request::Clunk>(request).fid);
+}
+
+
+TEST(P9, parseResponseIntoRejectsMessageOfOtherDialect) {
+	byte buffer[128];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+	styxe::Encoder encoder{byteStream};
+	encoder << makeHeaderWithPayload(asByte(MessageType::TRead), 2, 0);
+
+	auto parser = createResponseParser(kProtocolVersion, 128);
+	ASSERT_TRUE(parser.isOk());
+
+	ResponseMessage response;
+	auto reader = ByteReader{byteStream.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	EXPECT_TRUE(parser.unwrap().parseResponse(*header, reader, response).isError());
+}
+
+
+TEST(P9, parseRequestIntoWithCustomParserTable) {
+	byte buffer[128];
+	auto byteStream = ByteWriter{wrapMemory(buffer)};
+	RequestWriter clunk{byteStream, 1};
+	clunk << Request::Clunk{17};
+
+	static RequestParseTable const table = [] {
+		RequestParseTable result{};
+		for (auto& entry : result) {
+			entry = [](ByteReader& data) -> styxe::Result<RequestMessage> {
+				Request::Clunk request{};
+				return (data >> request)
+						.then([&request](ByteReader&) { return RequestMessage{request}; });
+			};
+		}
+		return result;
+	}();
+	RequestParser parser{128, messageTypeToString, table};
+
+	RequestMessage request;
+	auto reader = ByteReader{byteStream.viewWritten()};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	ASSERT_TRUE(parser.parseRequest(*header, reader, request).isOk());
+	EXPECT_EQ(17U, std::get<Request::Clunk>(request).fid);
+}
@@ -0,0 +1,188 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_messageSchema.cpp
+ *
+ *******************************************************************************/
+#include "styxe/messageSchema.hpp"
+#include "styxe/9p2000u.hpp"
+#include "styxe/9p2000e.hpp"
+#include "styxe/9p2000L.hpp"
+#include "styxe/messageParser.hpp"
+
+#include "testHarnes.hpp"
+
+#include <string>
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+static_assert(isFixedSize<Request::Read>(), "TRead has fixed size");
+static_assert(!isFixedSize<Request::Walk>(), "TWalk has variable size");
+static_assert(isFixedSize<Response::Clunk>(), "RClunk has no fields");
+static_assert(isFixedSize<_9P2000E::Request::Session>(), "TSession has fixed size");
+
+static_assert(fixedSizeOf<Request::Read>() == 16, "TRead payload is 16 bytes");
+static_assert(fixedSizeOf<Response::Open>() == 17, "ROpen payload is 17 bytes");
+static_assert(fixedSizeOf<_9P2000E::Request::Session>() == 8, "TSession payload is 8 bytes");
+static_assert(fixedSizeOf<_9P2000L::Response::GetAttr>() == 153, "Rgetattr payload is 153 bytes");
+static_assert(protocolSize(Request::Read{}) == 16, "Size of fixed size message is a constant expression");
+static_assert(messageSize<Response::Clunk>() == 7, "RClunk is a header only");
+static_assert(messageSize<_9P2000L::Response::GetAttr>() == 160, "Rgetattr is 160 bytes");
+
+static_assert(fieldOffset<&Request::Read::fid>() == 0, "First field starts the payload");
+static_assert(fieldOffset<&Request::Read::count>() == 12, "TRead count follows fid and offset");
+static_assert(fieldOffset<&Request::Walk::newfid, Request::Walk>() == 4, "Inherited field of TWalk");
+static_assert(fieldOffset<&Request::Walk::path>() == 8, "TWalk path follows fids");
+static_assert(fieldOffset<&_9P2000L::Response::GetAttr::mode>() == 21, "Offset follows wire order, not member order");
+
+
+namespace  {
+
+class MessageSchemas : public TestHarnes {
+protected:
+
+	template<typename Message>
+	size_type writtenPayloadSize(Message const& message) {
+		RequestWriter writer{_writer};
+		writer << message;
+
+		return writer.header().payloadSize();
+	}
+
+	/// Check that size of each default constructed message of a variant matches its encoded size.
+	template<typename Writer, typename Variant, std::size_t...I>
+	void expectMessageSizeMatchesEncoded(std::index_sequence<I...>) {
+		(expectMessageSizeMatchesEncoded<Writer>(Variant{std::in_place_index<I>}), ...);
+	}
+
+	template<typename Writer, typename Variant>
+	void expectMessageSizeMatchesEncoded(Variant const& message) {
+		_writer.rewind();
+		std::visit([this](auto const& m) {
+			Writer writer{_writer};
+			writer << m;
+		}, message);
+
+		EXPECT_EQ(_writer.position(), messageSize(message)) << "Message index: " << message.index();
+	}
+
+	template<typename Message>
+	size_type writtenResponseSize(Message const& message) {
+		ResponseWriter writer{_writer};
+		writer << message;
+
+		return writer.header().payloadSize();
+	}
+};
+
+}  // namespace
+
+
+TEST_F(MessageSchemas, fieldsAreVisitedInWireOrder) {
+	_9P2000L::Request::Lock message{};
+
+	std::vector<std::string> names;
+	forEachField(message, [&names](char const* name, auto const&) {
+		names.emplace_back(name);
+	});
+
+	EXPECT_EQ((std::vector<std::string>{"fid", "type", "flags", "start", "length", "proc_id", "client_id"}), names);
+}
+
+
+TEST_F(MessageSchemas, fieldsOfBaseMessageAreIncluded) {
+	_9P2000U::Request::Attach message{};
+	message.fid = 3;
+	message.afid = 7;
+	message.n_uname = 42;
+
+	Solace::uint64 sum = 0;
+	std::vector<std::string> names;
+	forEachField(message, [&](char const* name, auto const& value) {
+		names.emplace_back(name);
+		if constexpr (std::is_integral<std::decay_t<decltype(value)>>::value) {
+			sum += value;
+		}
+	});
+
+	EXPECT_EQ((std::vector<std::string>{"fid", "afid", "uname", "aname", "n_uname"}), names);
+	EXPECT_EQ(52U, sum);
+}
+
+
+TEST_F(MessageSchemas, protocolSizeMatchesEncodedSizeOfVariableMessages) {
+	byte buffer[6 + 5 + 4 + 3*2];
+	ByteWriter pathWriter{wrapMemory(buffer)};
+	styxe::Encoder encoder{pathWriter};
+	encoder << StringView{"folder"}
+			<< StringView{"other"}
+			<< StringView{"file"};
+
+	Request::Walk walk{};
+	walk.fid = 1;
+	walk.newfid = 2;
+	walk.path = WalkPath{3, wrapMemory(buffer)};
+	ASSERT_EQ(protocolSize(walk), writtenPayloadSize(walk));
+
+	_writer.rewind();
+	_9P2000U::Request::Create create{};
+	create.name = "some-file";
+	create.extension = "ext";
+	ASSERT_EQ(protocolSize(create), writtenPayloadSize(create));
+
+	_writer.rewind();
+	_9P2000L::Response::GetLock getLock{};
+	getLock.client_id = "client";
+	ASSERT_EQ(protocolSize(getLock), writtenResponseSize(getLock));
+}
+
+
+TEST_F(MessageSchemas, protocolSizeMatchesEncodedSizeOfFixedMessages) {
+	_9P2000E::Request::Session session{{1, 2, 3, 4, 5, 6, 7, 8}};
+	ASSERT_EQ(protocolSize(session), writtenPayloadSize(session));
+
+	_writer.rewind();
+	_9P2000L::Response::GetAttr getAttr{};
+	ASSERT_EQ(protocolSize(getAttr), writtenResponseSize(getAttr));
+
+	_writer.rewind();
+	ASSERT_EQ(0U, writtenResponseSize(Response::Clunk{}));
+}
+
+
+TEST_F(MessageSchemas, messageSizeMatchesEncodedSizeOfAllMessages) {
+	expectMessageSizeMatchesEncoded<RequestWriter, RequestMessage>(
+				std::make_index_sequence<std::variant_size<RequestMessage>::value>{});
+	expectMessageSizeMatchesEncoded<ResponseWriter, ResponseMessage>(
+				std::make_index_sequence<std::variant_size<ResponseMessage>::value>{});
+}
+
+
+TEST_F(MessageSchemas, messageSizeOfWalkResponse) {
+	byte buffer[2 * 13];
+	Response::Walk walk{};
+	walk.qids = QidSpan{2, wrapMemory(buffer)};
+
+	ResponseWriter writer{_writer};
+	writer << walk;
+	ASSERT_EQ(headerSize() + 2 + 2 * 13, messageSize(walk));
+	ASSERT_EQ(_writer.position(), messageSize(walk));
+}
@@ -0,0 +1,222 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_messageView.cpp
+ *
+ *******************************************************************************/
+#include "styxe/messageView.hpp"
+#include "styxe/messageWriter.hpp"
+#include "styxe/messageParser.hpp"
+#include "styxe/9p2000L.hpp"
+
+#include "testHarnes.hpp"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class MessageViews : public TestHarnes {
+protected:
+
+	template<typename View, typename Message>
+	View getViewOrFail() {
+		ByteReader reader{_writer.viewWritten()};
+
+		auto maybeHeader = parseMessageHeader(reader);
+		if (!maybeHeader) {
+			logFailure(maybeHeader.getError());
+			return {};
+		}
+
+		EXPECT_EQ(messageCodeOf<Message>(), maybeHeader.unwrap().type);
+
+		View view;
+		auto result = reader >> view;
+		if (!result) {
+			logFailure(result.getError());
+			return {};
+		}
+
+		EXPECT_EQ(0U, reader.remaining());
+
+		return view;
+	}
+
+	Stat makeStat() {
+		Stat stat;
+		stat.size = 124;
+		stat.type = 1;
+		stat.dev = 8828;
+		stat.qid = randomQid();
+		stat.mode = 111;
+		stat.atime = 21;
+		stat.mtime = 17;
+		stat.length = 818177;
+		stat.name = "la-la McFile";
+		stat.uid = "Userface McUse";
+		stat.gid = "Other user";
+		stat.muid = "Modifier";
+
+		return stat;
+	}
+};
+
+}  // namespace
+
+
+TEST_F(MessageViews, walk) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{"space"}
+		   << StringView{"knowhere"};
+	writer.updateMessageSize();
+
+	auto view = getViewOrFail<WalkView, Request::Walk>();
+	EXPECT_EQ(213U, view.fid());
+	EXPECT_EQ(124U, view.newfid());
+	EXPECT_EQ(2U, view.nSegments());
+
+	auto const path = view.path();
+	ASSERT_EQ(2U, path.size());
+	EXPECT_EQ("space", *path.begin());
+
+	auto const& index = view.pathIndex();
+	ASSERT_EQ(2U, index.size());
+	EXPECT_EQ("space", index[0]);
+	EXPECT_EQ("knowhere", index[1]);
+	EXPECT_FALSE(index.hasParentSegments());
+}
+
+
+TEST_F(MessageViews, walkToParentDirectory) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{""}
+		   << StringView{".."}
+		   << StringView{"sibling"};
+
+	auto view = getViewOrFail<WalkView, Request::Walk>();
+	auto const& index = view.pathIndex();
+	ASSERT_EQ(3U, index.size());
+	EXPECT_EQ("", index[0]);
+	EXPECT_EQ("..", index[1]);
+	EXPECT_EQ("sibling", index[2]);
+	EXPECT_TRUE(index.hasParentSegments());
+}
+
+
+TEST_F(MessageViews, walkWithTooManySegmentsIsRejected) {
+	RequestWriter writer{_writer};
+	auto pathWriter = writer << Request::Partial::Walk{213, 124};
+	for (int i = 0; i <= WalkPathIndex::kMaxSegments; ++i) {
+		pathWriter.segment("dir");
+	}
+
+	ByteReader reader{_writer.viewWritten()};
+	ASSERT_TRUE(parseMessageHeader(reader).isOk());
+
+	WalkView view;
+	EXPECT_TRUE((reader >> view).isError());
+}
+
+
+TEST_F(MessageViews, walkWithTruncatedSegmentIsRejected) {
+	RequestWriter writer{_writer};
+	writer << Request::Partial::Walk{213, 124}
+		   << StringView{"space"};
+	writer.updateMessageSize();
+
+	auto const written = _writer.viewWritten();
+	ByteReader reader{written.slice(headerSize(), written.size() - 1)};
+
+	WalkView view;
+	EXPECT_TRUE((reader >> view).isError());
+	EXPECT_EQ(0U, reader.position());
+}
+
+
+TEST_F(MessageViews, wstat) {
+	auto const stat = makeStat();
+
+	RequestWriter writer{_writer};
+	writer << Request::WStat{8193, stat};
+
+	auto view = getViewOrFail<WStatView, Request::WStat>();
+	EXPECT_EQ(8193U, view.fid());
+	EXPECT_EQ(stat.type, view.type());
+	EXPECT_EQ(stat.dev, view.dev());
+	EXPECT_EQ(stat.qid, view.qid());
+	EXPECT_EQ(stat.mode, view.mode());
+	EXPECT_EQ(stat.atime, view.atime());
+	EXPECT_EQ(stat.mtime, view.mtime());
+	EXPECT_EQ(stat.length, view.length());
+	EXPECT_EQ(stat.name, view.name());
+	EXPECT_EQ(stat.uid, view.uid());
+	EXPECT_EQ(stat.gid, view.gid());
+	EXPECT_EQ(stat.muid, view.muid());
+	EXPECT_EQ(stat, view.stat());
+}
+
+
+TEST_F(MessageViews, wstat9P2000U) {
+	_9P2000U::StatEx stat;
+	static_cast<Stat&>(stat) = makeStat();
+	stat.extension = "Extra ext";
+	stat.n_uid = 1;
+	stat.n_gid = 2;
+	stat.n_muid = 3;
+
+	RequestWriter writer{_writer};
+	writer << _9P2000U::Request::WStat{8193, stat};
+
+	auto view = getViewOrFail<_9P2000U::WStatView, _9P2000U::Request::WStat>();
+	EXPECT_EQ(8193U, view.fid());
+	EXPECT_EQ(stat.muid, view.muid());
+	EXPECT_EQ(stat.extension, view.extension());
+	EXPECT_EQ(1U, view.n_uid());
+	EXPECT_EQ(2U, view.n_gid());
+	EXPECT_EQ(3U, view.n_muid());
+	EXPECT_EQ(stat, view.stat());
+}
+
+
+TEST_F(MessageViews, getAttr) {
+	auto const qid = randomQid();
+	ResponseWriter writer{_writer, 3};
+	writer << _9P2000L::Response::GetAttr{
+			  qid, 123, 654, 234, 435, 12734,
+			  234141, 312, 435, 6345,
+			  12341, 452,
+			  4, 145, 23452435, 5132,
+			  1324, 134, 1234, 7645};
+
+	auto view = getViewOrFail<_9P2000L::GetAttrView, _9P2000L::Response::GetAttr>();
+	EXPECT_EQ(qid, view.qid());
+	EXPECT_EQ(123U, view.valid());
+	EXPECT_EQ(654U, view.mode());
+	EXPECT_EQ(234U, view.uid());
+	EXPECT_EQ(435U, view.gid());
+	EXPECT_EQ(12734U, view.size());
+	EXPECT_EQ(234141U, view.atime_sec());
+	EXPECT_EQ(6345U, view.mtime_nsec());
+	EXPECT_EQ(4U, view.nlink());
+	EXPECT_EQ(5132U, view.blocks());
+	EXPECT_EQ(7645U, view.data_version());
+}
@@ -0,0 +1,152 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_payloadAlignment.cpp
+ *
+ *******************************************************************************/
+#include "styxe/payloadAlignment.hpp"  // Class being tested
+#include "styxe/messageWriter.hpp"
+#include "styxe/messageParser.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+static_assert(payloadOffset<Response::Read>() == 11, "RRead payload offset");
+static_assert(payloadOffset<Request::Write>() == 23, "TWrite payload offset");
+static_assert(payloadOffset<_9P2000E::Response::ShortRead>() == 11, "RShortRead payload offset");
+static_assert(!hasTrailingPayload<Request::Read>(), "TRead has no payload");
+static_assert(!hasTrailingPayload<_9P2000E::Request::ShortWrite>(), "TShortWrite payload follows a variable path");
+static_assert(alignDown(8191) == 4096 && alignDown(8192) == 8192 && alignDown(100) == 0, "Size rounded down to a page");
+static_assert(alignDown(100, 64) == 64, "Size rounded down to a given alignment");
+
+
+namespace  {
+
+bool isAligned(void const* address, size_type alignment = kDirectIoAlignment) {
+	return reinterpret_cast<std::uintptr_t>(address) % alignment == 0;
+}
+
+struct AlignedBuffer {
+	alignas(kDirectIoAlignment) byte data[3 * kDirectIoAlignment];
+};
+
+}  // namespace
+
+
+TEST(PayloadAlignment, payloadOffsetOfMessageType) {
+	EXPECT_EQ(payloadOffset<Response::Read>(), payloadOffset(asByte(MessageType::RRead)));
+	EXPECT_EQ(payloadOffset<Request::Write>(), payloadOffset(asByte(MessageType::TWrite)));
+	EXPECT_EQ(0U, payloadOffset(asByte(MessageType::TRead)));
+}
+
+
+TEST(PayloadAlignment, alignedFrameOffset) {
+	AlignedBuffer buffer{};
+	EXPECT_EQ(kDirectIoAlignment - 11, alignedFrameOffset(buffer.data, 11));
+	EXPECT_EQ(kDirectIoAlignment - 12, alignedFrameOffset(buffer.data + 1, 11));
+	EXPECT_EQ(0U, alignedFrameOffset(buffer.data + kDirectIoAlignment - 11, 11));
+	EXPECT_EQ(0U, alignedFrameOffset(buffer.data, 0));
+	EXPECT_EQ(5U, alignedFrameOffset(buffer.data, 3, 8));
+}
+
+
+TEST(PayloadAlignment, readResponsePayloadIsAligned) {
+	AlignedBuffer buffer{};
+	auto maybeFrame = alignPayload(wrapMemory(buffer.data).slice(3, sizeof(buffer.data)), payloadOffset<Response::Read>());
+	ASSERT_TRUE(maybeFrame.isOk());
+
+	ByteWriter dest{maybeFrame.unwrap()};
+	ResponseWriter writer{dest, 1};
+	auto dataWriter = writer << Response::Partial::Read{};
+	auto view = dataWriter.reserve(kDirectIoAlignment, kMaxMessageSize);
+	ASSERT_EQ(kDirectIoAlignment, view.size());
+	EXPECT_TRUE(isAligned(view.dataAddress()));
+
+	view.fill(0xA5);  // pread(fd, view.dataAddress(), view.size(), offset)
+	ASSERT_TRUE(dataWriter.commit(view.size()).isOk());
+
+	// Writer only holds the frame: padding is not sent
+	auto const frame = dest.viewWritten();
+	ByteReader reader{frame};
+	auto header = parseMessageHeader(reader);
+	ASSERT_TRUE(header.isOk());
+	EXPECT_EQ(payloadOffset<Response::Read>() + kDirectIoAlignment, header.unwrap().messageSize);
+	EXPECT_EQ(header.unwrap().messageSize, frame.size());
+}
+
+
+TEST(PayloadAlignment, alignPayloadFailsWhenNoSpace) {
+	AlignedBuffer buffer{};
+
+	EXPECT_TRUE(alignPayload(wrapMemory(buffer.data + 1, kDirectIoAlignment / 2), payloadOffset<Request::Write>())
+				.isError());
+}
+
+
+TEST(PayloadAlignment, receivedWritePayloadIsAligned) {
+	char const content[] = "Data to be written to a file";
+
+	// Frame as received from a socket
+	byte message[128];
+	ByteWriter messageWriter{wrapMemory(message)};
+	RequestWriter requestWriter{messageWriter, 1};
+	requestWriter << Request::Write{42, 0, wrapMemory(content)};
+	auto const frame = messageWriter.viewWritten();
+
+	// Read header first, then the rest of the frame into the buffer so that the payload is aligned
+	ByteReader headerReader{frame};
+	auto maybeHeader = parseMessageHeader(headerReader);
+	ASSERT_TRUE(maybeHeader.isOk());
+	auto const header = maybeHeader.unwrap();
+
+	AlignedBuffer buffer{};
+	auto maybeBody = alignReceivedPayload(wrapMemory(buffer.data).slice(5, sizeof(buffer.data)), header);
+	ASSERT_TRUE(maybeBody.isOk());
+
+	auto body = maybeBody.unwrap();
+	ASSERT_EQ(header.payloadSize(), body.size());
+	memcpy(body.dataAddress(), frame.dataAddress() + headerSize(), body.size());  // recv(socket, ...)
+
+	auto parser = createRequestParser(kProtocolVersion, kMaxMessageSize).unwrap();
+	ByteReader reader{body};
+	auto maybeRequest = parser.parseRequest(header, reader);
+	ASSERT_TRUE(maybeRequest.isOk());
+
+	auto const& write = std::get<Request::Write>(*maybeRequest);
+	EXPECT_EQ(wrapMemory(content), write.data);
+	EXPECT_TRUE(isAligned(write.data.dataAddress()));
+}
+
+
+TEST(PayloadAlignment, receivedMessageWithoutPayloadIsNotMoved) {
+	AlignedBuffer buffer{};
+	MessageHeader const header{headerSize() + 4, asByte(MessageType::TClunk), 1};
+
+	auto maybeBody = alignReceivedPayload(wrapMemory(buffer.data), header);
+	ASSERT_TRUE(maybeBody.isOk());
+	EXPECT_EQ(buffer.data + headerSize(), maybeBody.unwrap().dataAddress());
+	EXPECT_EQ(4U, maybeBody.unwrap().size());
+
+	EXPECT_TRUE(alignReceivedPayload(wrapMemory(buffer.data, headerSize() + 3), header).isError());
+}
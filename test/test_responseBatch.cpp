@@ -0,0 +1,222 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_responseBatch.cpp
+ *
+ *******************************************************************************/
+#include "styxe/responseBatch.hpp"  // Class being tested
+#include "styxe/frameAssembler.hpp"
+#include "styxe/messageParser.hpp"
+
+#include "testHarnes.hpp"
+
+#include <algorithm>  // std::min
+#include <limits>
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+namespace  {
+
+class ResponseBatchTest : public TestHarnes {
+protected:
+
+	/// Sink that gathers flushed io vectors into a single byte stream, as writev would do.
+	/// Sends at most _sinkLimit bytes per call to simulate short writes.
+	auto sink() {
+		return [this](iovec const* vecs, int count) -> styxe::Result<size_type> {
+			_flushes += 1;
+			size_type nSent = 0;
+			for (int i = 0; i < count && nSent < _sinkLimit; ++i) {
+				auto const base = static_cast<byte const*>(vecs[i].iov_base);
+				auto const len = std::min<size_type>(narrow_cast<size_type>(vecs[i].iov_len), _sinkLimit - nSent);
+				_sent.insert(_sent.end(), base, base + len);
+				nSent += len;
+			}
+
+			return Ok(nSent);
+		};
+	}
+
+	/// Parse all messages sent so far.
+	std::vector<Tag> sentTags() {
+		auto parser = createResponseParser(kProtocolVersion, kMaxMessageSize).unwrap();
+
+		std::vector<Tag> tags;
+		byte staging[128];
+		FrameAssembler assembler{wrapMemory(staging), kMaxMessageSize};
+		auto result = assembler.feed(wrapMemory(_sent.data(), _sent.size()),
+									 [&](MessageHeader header, ByteReader& payload) {
+			tags.push_back(header.tag);
+
+			auto maybeMessage = parser.parseResponse(header, payload);
+			if (!maybeMessage) {
+				logFailure(maybeMessage.getError());
+			}
+		});
+		EXPECT_TRUE(result.isOk());
+
+		return tags;
+	}
+
+	char const				_payload[36] = "This is a very important data d-_^b";
+
+	int						_flushes{0};
+	size_type				_sinkLimit{std::numeric_limits<size_type>::max()};
+	std::vector<byte>		_sent;
+};
+
+}  // namespace
+
+
+TEST_F(ResponseBatchTest, responsesAreCoalescedIntoSingleIoVec) {
+	ResponseBatch batch{_memBuf.view()};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+	ASSERT_TRUE(batch.append(2, Response::Write{42}, sink()).isOk());
+	ASSERT_TRUE(batch.append(3, Response::Flush{}, sink()).isOk());
+
+	EXPECT_EQ(0, _flushes);
+	EXPECT_EQ(3U, batch.size());
+	EXPECT_EQ(1, batch.ioVecCount());
+	EXPECT_EQ(3*headerSize() + sizeof(uint32), batch.byteSize());
+
+	EXPECT_EQ(2U, batch.message(1).tag);
+	EXPECT_EQ(headerSize(), batch.message(1).offset);
+	EXPECT_EQ(headerSize() + sizeof(uint32), batch.message(1).size);
+
+	ASSERT_TRUE(batch.flush(sink()).isOk());
+	EXPECT_EQ(1, _flushes);
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ((std::vector<Tag>{1, 2, 3}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, readPayloadIsReferencedNotCopied) {
+	auto const data = wrapMemory(_payload);
+
+	ResponseBatch batch{_memBuf.view()};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+	ASSERT_TRUE(batch.append(2, Response::Read{data}, sink()).isOk());
+	ASSERT_TRUE(batch.append(3, Response::Clunk{}, sink()).isOk());
+
+	ASSERT_EQ(3, batch.ioVecCount());
+	EXPECT_EQ(data.dataAddress(), batch.ioVecs()[1].iov_base);
+	EXPECT_EQ(headerSize() + sizeof(size_type) + data.size(), batch.message(1).size);
+
+	ASSERT_TRUE(batch.flush(sink()).isOk());
+	EXPECT_EQ((std::vector<Tag>{1, 2, 3}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, flushedWhenMessageCountThresholdReached) {
+	ResponseBatch batch{_memBuf.view(), kMaxMessageSize, 2};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+	EXPECT_EQ(0, _flushes);
+	ASSERT_TRUE(batch.append(2, Response::Clunk{}, sink()).isOk());
+	EXPECT_EQ(1, _flushes);
+	EXPECT_TRUE(batch.empty());
+
+	ASSERT_TRUE(batch.append(3, Response::Clunk{}, sink()).isOk());
+	EXPECT_EQ(1U, batch.size());
+	EXPECT_EQ((std::vector<Tag>{1, 2}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, flushedWhenByteThresholdReached) {
+	auto const data = wrapMemory(_payload);
+
+	ResponseBatch batch{_memBuf.view(), 32};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+	EXPECT_EQ(0, _flushes);
+	ASSERT_TRUE(batch.append(2, Response::Read{data}, sink()).isOk());
+	EXPECT_EQ(1, _flushes);
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ((std::vector<Tag>{1, 2}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, flushedWhenOutputBufferIsFull) {
+	byte buffer[2*(headerSize() + sizeof(uint32)) + 4];
+
+	ResponseBatch batch{wrapMemory(buffer)};
+	ASSERT_TRUE(batch.append(1, Response::Write{1}, sink()).isOk());
+	ASSERT_TRUE(batch.append(2, Response::Write{2}, sink()).isOk());
+	EXPECT_EQ(0, _flushes);
+
+	ASSERT_TRUE(batch.append(3, Response::Write{3}, sink()).isOk());
+	EXPECT_EQ(1, _flushes);
+	EXPECT_EQ(1U, batch.size());
+	EXPECT_EQ(3U, batch.message(0).tag);
+	EXPECT_EQ((std::vector<Tag>{1, 2}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, messageLargerThanBufferIsRejected) {
+	byte buffer[headerSize()];
+
+	ResponseBatch batch{wrapMemory(buffer)};
+	ASSERT_TRUE(batch.append(1, Response::Write{1}, sink()).isError());
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ(0, _flushes);
+}
+
+
+TEST_F(ResponseBatchTest, shortWriteKeepsMessagesNotSent) {
+	auto const data = wrapMemory(_payload);
+	ResponseBatch batch{_memBuf.view()};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+	ASSERT_TRUE(batch.append(2, Response::Read{data}, sink()).isOk());
+	ASSERT_TRUE(batch.append(3, Response::Write{42}, sink()).isOk());
+
+	// Sink sends the first message and a part of the second one
+	_sinkLimit = headerSize() + 5;
+	ASSERT_TRUE(batch.flush(sink()).isOk());
+	EXPECT_FALSE(batch.empty());
+	EXPECT_EQ(3U, batch.size());
+	EXPECT_EQ(headerSize() + 5, batch.bytesSent());
+	ASSERT_EQ(1U, batch.messagesSent());
+	EXPECT_EQ(1, batch.message(0).tag);
+	EXPECT_EQ(2, batch.message(batch.messagesSent()).tag);
+
+	// Rest of the batch is sent by the next flush
+	_sinkLimit = std::numeric_limits<size_type>::max();
+	ASSERT_TRUE(batch.flush(sink()).isOk());
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ(0U, batch.bytesSent());
+	EXPECT_EQ(2, _flushes);
+
+	EXPECT_EQ((std::vector<Tag>{1, 2, 3}), sentTags());
+}
+
+
+TEST_F(ResponseBatchTest, failedFlushKeepsBatch) {
+	ResponseBatch batch{_memBuf.view()};
+	ASSERT_TRUE(batch.append(1, Response::Clunk{}, sink()).isOk());
+
+	auto result = batch.flush([](iovec const*, int) -> styxe::Result<size_type> {
+		return getCannedError(CannedError::NotEnoughSpace);
+	});
+	ASSERT_TRUE(result.isError());
+	EXPECT_EQ(1U, batch.size());
+	EXPECT_EQ(0U, batch.messagesSent());
+
+	ASSERT_TRUE(batch.flush(sink()).isOk());
+	EXPECT_EQ((std::vector<Tag>{1}), sentTags());
+}
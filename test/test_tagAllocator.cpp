@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * libstyxe Unit Test Suit
+ * @file: test/test_tagAllocator.cpp
+ *
+ *******************************************************************************/
+#include "styxe/tagAllocator.hpp"  // Class being tested
+
+#include "testHarnes.hpp"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+TEST(TagAllocator, acquireUniqueTagsUntilExhausted) {
+	TagAllocator tags{3};
+	ASSERT_EQ(3U, tags.capacity());
+
+	std::set<Tag> acquired;
+	for (size_type i = 0; i < tags.capacity(); ++i) {
+		auto maybeTag = tags.acquire();
+		ASSERT_TRUE(maybeTag.isOk());
+		EXPECT_LT(*maybeTag, 3);
+		acquired.insert(*maybeTag);
+	}
+
+	EXPECT_EQ(3U, acquired.size());
+	EXPECT_EQ(3U, tags.inFlight());
+	EXPECT_TRUE(tags.acquire().isError());
+
+	tags.release(1);
+	EXPECT_EQ(2U, tags.inFlight());
+	auto maybeTag = tags.acquire();
+	ASSERT_TRUE(maybeTag.isOk());
+	EXPECT_EQ(1, *maybeTag);
+}
+
+
+TEST(TagAllocator, neverAllocatesNoTag) {
+	TagAllocator tags;
+	ASSERT_EQ(TagAllocator::kMaxTags, tags.capacity());
+
+	for (size_type i = 0; i < tags.capacity(); ++i) {
+		auto maybeTag = tags.acquire();
+		ASSERT_TRUE(maybeTag.isOk());
+		ASSERT_NE(kNoTag, *maybeTag);
+	}
+
+	EXPECT_TRUE(tags.acquire().isError());
+}
+
+
+TEST(TagAllocator, concurrentAcquireAndRelease) {
+	TagAllocator tags{16};
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&tags]() noexcept {
+			for (int i = 0; i < 10000; ++i) {
+				auto maybeTag = tags.acquire();
+				if (maybeTag) {
+					tags.release(*maybeTag);
+				}
+			}
+		});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(0U, tags.inFlight());
+
+	std::set<Tag> acquired;
+	for (size_type i = 0; i < tags.capacity(); ++i) {
+		acquired.insert(*tags.acquire());
+	}
+	EXPECT_EQ(16U, acquired.size());
+}
+
+
+TEST(PendingRequests, routeResponseToCompletion) {
+	PendingRequests<int> pending{8};
+
+	auto readTag = pending.add<Request::Read>(1);
+	auto clunkTag = pending.add<Request::Clunk>(2);
+	ASSERT_TRUE(readTag.isOk());
+	ASSERT_TRUE(clunkTag.isOk());
+	EXPECT_EQ(2U, pending.inFlight());
+	EXPECT_EQ(asByte(MessageType::RRead), pending.expectedResponseType(*readTag));
+
+	auto completion = pending.complete(MessageHeader{7, asByte(MessageType::RClunk), *clunkTag});
+	ASSERT_TRUE(completion.isOk());
+	EXPECT_EQ(2, *completion);
+	EXPECT_EQ(1U, pending.inFlight());
+
+	// Tag has been released
+	EXPECT_TRUE(pending.complete(MessageHeader{7, asByte(MessageType::RClunk), *clunkTag}).isError());
+	EXPECT_EQ(0, pending.expectedResponseType(*clunkTag));
+}
+
+
+TEST(PendingRequests, errorResponseCompletesAnyRequest) {
+	PendingRequests<int> pending{8};
+
+	auto tag = pending.add<_9P2000L::Request::GetAttr>(42);
+	ASSERT_TRUE(tag.isOk());
+
+	auto completion = pending.complete(MessageHeader{11, asByte(_9P2000L::MessageType::Rlerror), *tag});
+	ASSERT_TRUE(completion.isOk());
+	EXPECT_EQ(42, *completion);
+}
+
+
+TEST(PendingRequests, unexpectedResponseIsRejected) {
+	PendingRequests<int> pending{2};
+
+	auto tag = pending.add<Request::Read>(1);
+	ASSERT_TRUE(tag.isOk());
+
+	EXPECT_TRUE(pending.complete(MessageHeader{7, asByte(MessageType::RRead), kNoTag}).isError());
+	EXPECT_TRUE(pending.complete(MessageHeader{7, asByte(MessageType::RRead), 1}).isError());
+	EXPECT_TRUE(pending.complete(MessageHeader{7, asByte(MessageType::RWrite), *tag}).isError());
+	EXPECT_EQ(1U, pending.inFlight());
+
+	auto removed = pending.remove(*tag);
+	ASSERT_TRUE(removed.isOk());
+	EXPECT_EQ(1, *removed);
+	EXPECT_EQ(0U, pending.inFlight());
+}
+
+
+TEST(PendingRequests, addFailsWhenFull) {
+	PendingRequests<int> pending{1};
+
+	ASSERT_TRUE(pending.add<Request::Clunk>(1).isOk());
+	EXPECT_TRUE(pending.add<Request::Clunk>(2).isError());
+}